@@ -0,0 +1,244 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include "./systick.hpp"
+#include <cstdint>
+
+//! Cycle-accurate busy-wait delays.
+//! Cycle counts follow the Cortex-M0 TRM instruction timings (NOP, MOVS, LSLS, ADDS, SUBS: 1 cycle,
+//! taken conditional branch: 3 cycles, not taken: 1 cycle) and assume zero wait-state instruction fetch.
+//! \note With flash wait states every taken branch costs extra cycles, so delays run longer than requested.
+namespace ArmCortex::Delay {
+    inline constexpr uint32_t CYCLES_PER_LOOP = 4; //!< SUBS (1) + taken BNE (3).
+    inline constexpr uint32_t MAX_NOP_CYCLES = 16; //!< Delays up to this length are emitted as plain NOPs.
+
+    //! Instruction sequence emitted for a constant cycle count.
+    struct Plan {
+        uint32_t setup_cycles = 0; //!< Cycles spent loading the loop counter (0: no loop).
+        uint32_t iterations = 0; //!< Loop iterations (0: no loop).
+        uint32_t nops = 0; //!< Trailing NOPs padding the remainder.
+
+        //! Number of cycles the sequence takes to execute.
+        constexpr uint32_t cycles() const
+        {
+            if (iterations == 0) {
+                return nops;
+            }
+
+            // The final BNE falls through and costs 1 cycle instead of 3.
+            return setup_cycles + (iterations * CYCLES_PER_LOOP) - 2 + nops;
+        }
+
+        //! Number of instructions in the sequence.
+        constexpr uint32_t instructions() const
+        {
+            if (iterations == 0) {
+                return nops;
+            }
+
+            return setup_cycles + 2 + nops;
+        }
+    };
+
+    //! Largest loop counter a load of `setup_cycles` can produce: MOVS, or MOVS followed by (LSLS #8, ADDS) pairs.
+    constexpr uint32_t maxIterations(uint32_t setup_cycles)
+    {
+        return (uint32_t{1} << (((setup_cycles + 1) / 2) * 8)) - 1;
+    }
+
+    //! Plan the instruction sequence for a delay of `cycles` (at most the span of a single loop).
+    constexpr Plan plan(uint32_t cycles)
+    {
+        if (cycles <= MAX_NOP_CYCLES) {
+            return Plan { .nops = cycles };
+        }
+
+        // Pick the shortest counter load that still reaches the required iteration count.
+        for (uint32_t setup = 1; setup <= 5; setup += 2) {
+            const uint32_t loop_cycles = cycles - setup + 2;
+            const uint32_t iterations = loop_cycles / CYCLES_PER_LOOP;
+
+            if (iterations <= maxIterations(setup)) {
+                return Plan {
+                    .setup_cycles = setup,
+                    .iterations = iterations,
+                    .nops = loop_cycles % CYCLES_PER_LOOP
+                };
+            }
+        }
+
+        return Plan {};
+    }
+
+    //! Longest delay a single loop can produce.
+    inline constexpr uint32_t MAX_LOOP_CYCLES = Plan { 5, maxIterations(5), 0 }.cycles();
+
+    //! Core clock cycles in `microseconds` at `CORE_CLOCK_HZ`, rounded up.
+    //! Uses the exact clock, so clocks that are not a whole number of MHz are not rounded up per microsecond.
+    template<uint32_t CORE_CLOCK_HZ>
+    constexpr uint64_t microsecondsToCycles(uint32_t microseconds)
+    {
+        return ((uint64_t{CORE_CLOCK_HZ} * microseconds) + 999'999u) / 1'000'000u;
+    }
+
+    //! Run-time loop passes closest to `cycles`: each pass takes CYCLES_PER_LOOP, the final one 2 cycles less.
+    constexpr uint64_t loopIterations(uint64_t cycles)
+    {
+        return (cycles + 2) / CYCLES_PER_LOOP;
+    }
+
+    template<uint32_t N>
+    [[gnu::always_inline]] static inline void nops()
+    {
+        if constexpr (N > 0) {
+            asm volatile(".rept %c0\n\tnop\n\t.endr" : : "i" (N));
+        }
+    }
+
+    //! Emit the counter load and loop of a plan. Every operand is an immediate so the cycle count is fixed.
+    template<uint32_t SETUP_CYCLES, uint32_t ITERATIONS>
+    [[gnu::always_inline]] static inline void loop()
+    {
+        static_assert(ITERATIONS > 0 && ITERATIONS <= maxIterations(SETUP_CYCLES));
+
+        uint32_t counter;
+
+        if constexpr (SETUP_CYCLES == 1) {
+            asm volatile(
+                "movs %0, %1\n"
+                "1:\n\t"
+                "subs %0, #1\n\t"
+                "bne 1b"
+                : "=&l" (counter)
+                : "i" (ITERATIONS)
+                : "cc"
+            );
+        } else if constexpr (SETUP_CYCLES == 3) {
+            asm volatile(
+                "movs %0, %1\n\t"
+                "lsls %0, %0, #8\n\t"
+                "adds %0, %2\n"
+                "1:\n\t"
+                "subs %0, #1\n\t"
+                "bne 1b"
+                : "=&l" (counter)
+                : "i" (ITERATIONS >> 8), "i" (ITERATIONS & 0xFFu)
+                : "cc"
+            );
+        } else {
+            asm volatile(
+                "movs %0, %1\n\t"
+                "lsls %0, %0, #8\n\t"
+                "adds %0, %2\n\t"
+                "lsls %0, %0, #8\n\t"
+                "adds %0, %3\n"
+                "1:\n\t"
+                "subs %0, #1\n\t"
+                "bne 1b"
+                : "=&l" (counter)
+                : "i" (ITERATIONS >> 16), "i" ((ITERATIONS >> 8) & 0xFFu), "i" (ITERATIONS & 0xFFu)
+                : "cc"
+            );
+        }
+    }
+
+    //! Busy-wait for `iterations` loop passes (`iterations * CYCLES_PER_LOOP - 2` cycles, plus counter load).
+    //! \note `iterations` must not be zero.
+    [[gnu::always_inline]] static inline void loop(uint32_t iterations)
+    {
+        asm volatile(
+            "1:\n\t"
+            "subs %0, #1\n\t"
+            "bne 1b"
+            : "+l" (iterations)
+            :
+            : "cc"
+        );
+    }
+}
+
+namespace ArmCortex {
+    //! Busy-wait for exactly N core clock cycles.
+    //! Short delays are emitted as NOPs, longer ones as a counted loop padded with NOPs.
+    template<uint32_t N>
+    [[gnu::always_inline]] static inline void delayCycles()
+    {
+        if constexpr (N > Delay::MAX_LOOP_CYCLES) {
+            delayCycles<Delay::MAX_LOOP_CYCLES>();
+            delayCycles<N - Delay::MAX_LOOP_CYCLES>();
+        } else {
+            constexpr Delay::Plan PLAN = Delay::plan(N);
+
+            if constexpr (PLAN.iterations > 0) {
+                Delay::loop<PLAN.setup_cycles, PLAN.iterations>();
+            }
+
+            Delay::nops<PLAN.nops>();
+        }
+    }
+
+    //! Busy-wait for a constant number of microseconds, rounded up to whole cycles.
+    template<uint32_t CORE_CLOCK_HZ, uint32_t MICROSECONDS>
+    [[gnu::always_inline]] static inline void delayUs()
+    {
+        constexpr uint64_t CYCLES = Delay::microsecondsToCycles<CORE_CLOCK_HZ>(MICROSECONDS);
+        static_assert(CYCLES <= UINT32_MAX, "Delay too long, split it into several calls");
+
+        delayCycles<static_cast<uint32_t>(CYCLES)>();
+    }
+
+    //! Busy-wait for a run-time number of microseconds, rounded up to whole cycles.
+    //! \note Runs a few cycles longer for the call and a 64-bit multiply and divide, which take a few hundred
+    //!       cycles on a core without a hardware divider. Use the compile-time overload for short delays.
+    template<uint32_t CORE_CLOCK_HZ>
+    [[gnu::always_inline]] static inline void delayUs(uint32_t microseconds)
+    {
+        static_assert(CORE_CLOCK_HZ > 0, "Core clock must be at least 1 Hz");
+
+        uint64_t iterations = Delay::loopIterations(Delay::microsecondsToCycles<CORE_CLOCK_HZ>(microseconds));
+
+        // Delays past a 32-bit loop counter are split into several loops.
+        while (iterations > UINT32_MAX) {
+            Delay::loop(UINT32_MAX);
+            iterations -= UINT32_MAX;
+        }
+
+        if (iterations > 0) {
+            Delay::loop(static_cast<uint32_t>(iterations));
+        }
+    }
+
+    //! Measure the number of core clock cycles spent in `function` using SysTick.
+    //! \note SysTick must be running from the processor clock with LOAD large enough to cover the measured span
+    //!       (at most one wrap-around). The result includes a constant measurement overhead, which can be found
+    //!       by measuring an empty function.
+    template<typename Function>
+    [[gnu::always_inline]] static inline uint32_t measureCycles(Function&& function)
+    {
+        const uint32_t start = SYS_TICK->VAL;
+        function();
+        const uint32_t end = SYS_TICK->VAL;
+
+        // SysTick counts down; a wrap-around reloads from LOAD and counts LOAD + 1 ticks per period.
+        if (end <= start) {
+            return start - end;
+        }
+
+        return start + (SYS_TICK->LOAD + 1) - end;
+    }
+}
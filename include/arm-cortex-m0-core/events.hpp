@@ -0,0 +1,242 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include "./special_regs.hpp"
+#include <cstdint>
+
+namespace ArmCortex {
+    //! Wait for event. Sleeps until the event register is set, then clears it.
+    //! The event register is set by SEV, by an exception that preempts the current context
+    //! and, with SCR.SEVONPEND, by any interrupt becoming pending.
+    [[gnu::always_inline]] static inline void waitForEvent()
+    {
+        asm volatile("wfe" ::: "memory");
+    }
+
+    //! Send event. Sets the event register, so the next WFE returns immediately.
+    [[gnu::always_inline]] static inline void sendEvent()
+    {
+        asm volatile("sev" ::: "memory");
+    }
+
+    //! Masks all exceptions except NMI and HardFault for its lifetime and restores the previous PRIMASK afterwards.
+    //! Safe to nest and to use from ISRs.
+    class CriticalSection {
+    public:
+        [[gnu::always_inline]] CriticalSection() : primask(getPrimaskReg())
+        {
+            asm volatile("cpsid i" ::: "memory");
+        }
+
+        [[gnu::always_inline]] ~CriticalSection()
+        {
+            setPrimaskReg(primask);
+        }
+
+        CriticalSection(const CriticalSection&) = delete;
+        CriticalSection& operator=(const CriticalSection&) = delete;
+
+    private:
+        PRIMASK primask;
+    };
+
+    //! Single event flag. Signalling is one word-sized store, so it is lock-free from any ISR.
+    //! \note Intended for a single waiter.
+    class EventFlag {
+    public:
+        //! Signal the event. Callable from any ISR.
+        [[gnu::always_inline]] void set()
+        {
+            flag = 1;
+            sendEvent();
+        }
+
+        [[gnu::always_inline]] void clear()
+        {
+            flag = 0;
+        }
+
+        [[gnu::always_inline]] bool isSet() const
+        {
+            return flag != 0;
+        }
+
+        //! Sleep in WFE until the event is signalled, then consume it.
+        void wait()
+        {
+            while (flag == 0) {
+                waitForEvent();
+            }
+
+            flag = 0;
+        }
+
+    private:
+        volatile uint32_t flag = 0;
+    };
+
+    //! Group of up to 32 event flags.
+    //! Setting and clearing is a read-modify-write inside a short PRIMASK window, so it is callable from any ISR.
+    class EventFlags {
+    public:
+        //! Set the flags in `mask` and wake waiters. Callable from any ISR.
+        [[gnu::always_inline]] void set(uint32_t mask)
+        {
+            {
+                CriticalSection lock;
+                flags = flags | mask;
+            }
+
+            sendEvent();
+        }
+
+        //! Clear the flags in `mask`.
+        [[gnu::always_inline]] void clear(uint32_t mask)
+        {
+            CriticalSection lock;
+            flags = flags & ~mask;
+        }
+
+        [[gnu::always_inline]] uint32_t get() const
+        {
+            return flags;
+        }
+
+        //! Sleep in WFE until any flag in `mask` is set.
+        //! \return Flags from `mask` that were set. They are cleared if `clear_on_exit` is set.
+        //!         Returns 0 immediately for an empty `mask`.
+        uint32_t waitAny(uint32_t mask, bool clear_on_exit = true)
+        {
+            if (mask == 0) {
+                return 0;
+            }
+
+            while (true) {
+                if (const uint32_t matched = tryConsume(mask, clear_on_exit, false); matched != 0) {
+                    return matched;
+                }
+
+                waitForEvent();
+            }
+        }
+
+        //! Sleep in WFE until all flags in `mask` are set.
+        //! \return `mask`. The flags are cleared if `clear_on_exit` is set.
+        //!         Returns 0 immediately for an empty `mask`.
+        uint32_t waitAll(uint32_t mask, bool clear_on_exit = true)
+        {
+            if (mask == 0) {
+                return 0;
+            }
+
+            while (true) {
+                if (const uint32_t matched = tryConsume(mask, clear_on_exit, true); matched != 0) {
+                    return matched;
+                }
+
+                waitForEvent();
+            }
+        }
+
+    private:
+        //! Check for and optionally consume the flags in `mask` without a window for an ISR to slip in.
+        uint32_t tryConsume(uint32_t mask, bool clear_on_exit, bool all)
+        {
+            CriticalSection lock;
+            const uint32_t matched = flags & mask;
+
+            if ((matched == 0) || (all && (matched != mask))) {
+                return 0;
+            }
+
+            if (clear_on_exit) {
+                flags = flags & ~matched;
+            }
+
+            return matched;
+        }
+
+        volatile uint32_t flags = 0;
+    };
+
+    //! Counting semaphore.
+    //! Giving is a read-modify-write inside a short PRIMASK window, so it is callable from any ISR.
+    class Semaphore {
+    public:
+        //! Evaluated at compile time, so an `initial_count` above `maximum` is a compile error.
+        consteval explicit Semaphore(uint32_t initial_count = 0, uint32_t maximum = UINT32_MAX)
+            : counter(initial_count), max_count(maximum)
+        {
+            if (initial_count > maximum) {
+                invalidInitialCount();
+            }
+        }
+
+        //! Increment the count and wake waiters. Callable from any ISR.
+        //! \return False if the count is already at its maximum.
+        [[gnu::always_inline]] bool give()
+        {
+            {
+                CriticalSection lock;
+
+                if (counter == max_count) {
+                    return false;
+                }
+
+                counter = counter + 1;
+            }
+
+            sendEvent();
+            return true;
+        }
+
+        //! Decrement the count if it is non-zero. Callable from any ISR.
+        //! \return False if the count was zero.
+        [[gnu::always_inline]] bool tryTake()
+        {
+            CriticalSection lock;
+
+            if (counter == 0) {
+                return false;
+            }
+
+            counter = counter - 1;
+            return true;
+        }
+
+        //! Sleep in WFE until the count is non-zero, then decrement it.
+        void take()
+        {
+            while (!tryTake()) {
+                waitForEvent();
+            }
+        }
+
+        [[gnu::always_inline]] uint32_t count() const
+        {
+            return counter;
+        }
+
+    private:
+        //! Not constexpr, so reaching it from the constructor fails to compile.
+        static void invalidInitialCount() {}
+
+        volatile uint32_t counter;
+        const uint32_t max_count;
+    };
+}
@@ -139,7 +139,7 @@ namespace ArmCortex {
     [[gnu::always_inline]] static inline PSR getPsrReg()
     {
         PSR psr;
-        asm volatile("MRS %0, PSR" : "=r" (psr.value) : : "cc");
+        asm volatile("MRS %0, XPSR" : "=r" (psr.value) : : "cc");
         return psr;
     }
 
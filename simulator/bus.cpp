@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "./bus.hpp"
+
+#include <cstring>
+
+namespace ArmCortex::Simulator {
+    Bus::Bus(uint32_t flash_size, uint32_t ram_size) : flash(flash_size), ram(ram_size)
+    {
+    }
+
+    void Bus::map(uint32_t base, uint32_t size, Device& device)
+    {
+        mappings.push_back(Mapping { base, size, &device });
+    }
+
+    uint8_t* Bus::memory(uint32_t address, uint32_t size)
+    {
+        if ((address >= FLASH_BASE) && (uint64_t{address} - FLASH_BASE + size <= flash.size())) {
+            return flash.data() + (address - FLASH_BASE);
+        }
+
+        if ((address >= RAM_BASE) && (uint64_t{address} - RAM_BASE + size <= ram.size())) {
+            return ram.data() + (address - RAM_BASE);
+        }
+
+        return nullptr;
+    }
+
+    Device* Bus::device(uint32_t address, uint32_t& offset)
+    {
+        for (const Mapping& mapping : mappings) {
+            if ((address >= mapping.base) && (address - mapping.base < mapping.size)) {
+                offset = address - mapping.base;
+                return mapping.device;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::optional<uint32_t> Bus::read(uint32_t address, uint32_t size)
+    {
+        if ((address % size) != 0) {
+            return std::nullopt;
+        }
+
+        if (const uint8_t* bytes = memory(address, size)) {
+            uint32_t value = 0;
+            std::memcpy(&value, bytes, size);
+            return value;
+        }
+
+        uint32_t offset;
+
+        if (Device* target = device(address, offset)) {
+            const uint32_t shift = (offset % 4) * 8;
+            const uint32_t word = target->read(offset & ~3u) >> shift;
+            return (size == 4) ? word : (word & ((uint32_t{1} << (size * 8)) - 1));
+        }
+
+        return std::nullopt;
+    }
+
+    bool Bus::write(uint32_t address, uint32_t value, uint32_t size)
+    {
+        if ((address % size) != 0) {
+            return false;
+        }
+
+        if ((address >= RAM_BASE) && (memory(address, size) != nullptr)) {
+            std::memcpy(memory(address, size), &value, size);
+            return true;
+        }
+
+        uint32_t offset;
+
+        if (Device* target = device(address, offset)) {
+            const uint32_t shift = (offset % 4) * 8;
+            const uint32_t mask = (size == 4) ? 0xFFFFFFFFu : (((uint32_t{1} << (size * 8)) - 1) << shift);
+            target->write(offset & ~3u, (value << shift) & mask, mask);
+            return true;
+        }
+
+        return false;
+    }
+
+    bool Bus::load(uint32_t address, const uint8_t* data, size_t size)
+    {
+        if (size == 0) {
+            return true;
+        }
+
+        if (size > UINT32_MAX) {
+            return false;
+        }
+
+        uint8_t* bytes = memory(address, static_cast<uint32_t>(size));
+
+        if (bytes == nullptr) {
+            return false;
+        }
+
+        std::memcpy(bytes, data, size);
+        return true;
+    }
+}
@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace ArmCortex::Simulator {
+    //! Memory-mapped device. Accesses are word-aligned; sub-word writes are passed with a byte lane mask.
+    class Device {
+    public:
+        virtual ~Device() = default;
+
+        virtual uint32_t read(uint32_t offset) = 0;
+        virtual void write(uint32_t offset, uint32_t value, uint32_t mask) = 0;
+    };
+
+    //! System bus: flash at 0x00000000, SRAM at 0x20000000 and memory-mapped devices.
+    //! Accesses outside mapped regions, unaligned accesses and writes to flash fail (HardFault on the core).
+    class Bus {
+    public:
+        static constexpr uint32_t FLASH_BASE = 0x00000000u;
+        static constexpr uint32_t RAM_BASE = 0x20000000u;
+
+        Bus(uint32_t flash_size, uint32_t ram_size);
+
+        //! Map a device at [base, base + size).
+        void map(uint32_t base, uint32_t size, Device& device);
+
+        std::optional<uint32_t> read(uint32_t address, uint32_t size);
+        bool write(uint32_t address, uint32_t value, uint32_t size);
+
+        //! Copy an image into flash or SRAM, bypassing the flash write protection.
+        bool load(uint32_t address, const uint8_t* data, size_t size);
+
+    private:
+        struct Mapping {
+            uint32_t base;
+            uint32_t size;
+            Device* device;
+        };
+
+        //! Pointer to the backing memory of `size` bytes at `address`, or null if unmapped.
+        uint8_t* memory(uint32_t address, uint32_t size);
+
+        Device* device(uint32_t address, uint32_t& offset);
+
+        std::vector<uint8_t> flash;
+        std::vector<uint8_t> ram;
+        std::vector<Mapping> mappings;
+    };
+}
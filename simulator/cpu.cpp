@@ -0,0 +1,1193 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "./cpu.hpp"
+
+#include <arm-cortex-m0-core/bit_utils.hpp>
+#include <cstdio>
+
+namespace ArmCortex::Simulator {
+    namespace {
+        constexpr uint8_t SP = 13;
+        constexpr uint8_t LR = 14;
+        constexpr uint8_t PC = 15;
+
+        constexpr uint8_t HARD_FAULT = static_cast<uint8_t>(ExceptionNumber::HARD_FAULT);
+        constexpr uint8_t SV_CALL = static_cast<uint8_t>(ExceptionNumber::SV_CALL);
+
+        //! Semihosting operations.
+        constexpr uint32_t SYS_WRITEC = 0x03;
+        constexpr uint32_t SYS_WRITE0 = 0x04;
+        constexpr uint32_t SYS_WRITE = 0x05;
+        constexpr uint32_t SYS_EXIT = 0x18;
+        constexpr uint32_t SYS_EXIT_EXTENDED = 0x20;
+        constexpr uint32_t ADP_STOPPED_APPLICATION_EXIT = 0x20026;
+
+        //! Special register numbers (SYSm) accepted by MRS/MSR.
+        constexpr uint8_t SYSM_MSP = 8;
+        constexpr uint8_t SYSM_PSP = 9;
+        constexpr uint8_t SYSM_PRIMASK = 16;
+        constexpr uint8_t SYSM_CONTROL = 20;
+
+        //! Bit 9 of the stacked xPSR records the 4-byte stack realignment on exception entry.
+        constexpr uint8_t STACK_ALIGN_BIT = 9;
+        constexpr uint32_t FRAME_SIZE = 0x20;
+
+        constexpr uint32_t signExtend(uint32_t value, uint32_t bits)
+        {
+            const uint32_t sign = uint32_t{1} << (bits - 1);
+            return (value ^ sign) - sign;
+        }
+
+        constexpr uint32_t bitCount(uint32_t value)
+        {
+            uint32_t count = 0;
+
+            for (; value != 0; value &= value - 1) {
+                ++count;
+            }
+
+            return count;
+        }
+
+        constexpr bool isExcReturn(uint32_t address)
+        {
+            return (address & 0xF0000000u) == 0xF0000000u;
+        }
+    }
+
+    Cpu::Cpu(Bus& bus, ExceptionState& exceptions, ScbModel& scb, SysTickModel& sys_tick, uint64_t& cycles)
+        : bus(bus), exceptions(exceptions), scb(scb), sys_tick(sys_tick), cycles(cycles)
+    {
+    }
+
+    void Cpu::reset()
+    {
+        regs.fill(0);
+        psp = 0;
+        xpsr = PSR {};
+        primask = PRIMASK {};
+        control = CONTROL {};
+        sleeping = false;
+        sleeping_for_event = false;
+        faulted = false;
+        halt = Halt::NONE;
+        exit_code = 0;
+        retired = 0;
+        profiles = {};
+
+        exceptions.reset();
+        scb.reset();
+        sys_tick.reset();
+
+        msp = bus.read(0x00, 4).value_or(0) & ~3u;
+
+        const uint32_t entry = bus.read(0x04, 4).value_or(0);
+        regs[LR] = 0xFFFFFFFFu;
+        regs[PC] = entry & ~1u;
+        xpsr.bits.T = entry & 1u;
+    }
+
+    // =========================================================================
+    // Registers and Memory
+    // =========================================================================
+
+    int Cpu::executionPriority() const
+    {
+        return exceptions.executionPriority(primask.bits.PRIMASK);
+    }
+
+    uint32_t Cpu::sp() const
+    {
+        const bool use_psp = !isHandlerMode() && (control.bits.SPSEL == static_cast<uint32_t>(CONTROL::SPSEL::PSP));
+        return use_psp ? psp : msp;
+    }
+
+    void Cpu::setSp(uint32_t value)
+    {
+        const bool use_psp = !isHandlerMode() && (control.bits.SPSEL == static_cast<uint32_t>(CONTROL::SPSEL::PSP));
+        (use_psp ? psp : msp) = value & ~3u;
+    }
+
+    uint32_t Cpu::reg(uint8_t n) const
+    {
+        return (n == SP) ? sp() : regs[n];
+    }
+
+    uint32_t Cpu::readReg(uint8_t n) const
+    {
+        if (n == PC) {
+            return regs[PC] + 4;
+        }
+
+        return reg(n);
+    }
+
+    void Cpu::writeReg(uint8_t n, uint32_t value)
+    {
+        if (n == SP) {
+            setSp(value);
+        } else if (n == PC) {
+            branchTo(value & ~1u);
+        } else {
+            regs[n] = value;
+        }
+    }
+
+    uint32_t Cpu::load(uint32_t address, uint32_t size)
+    {
+        const std::optional<uint32_t> value = bus.read(address, size);
+
+        if (!value) {
+            faulted = true;
+            return 0;
+        }
+
+        return *value;
+    }
+
+    void Cpu::store(uint32_t address, uint32_t value, uint32_t size)
+    {
+        if (!bus.write(address, value, size)) {
+            faulted = true;
+        }
+    }
+
+    void Cpu::advance(uint32_t count)
+    {
+        cycles += count;
+        sys_tick.tick(count);
+    }
+
+    // =========================================================================
+    // Execution
+    // =========================================================================
+
+    Halt Cpu::step()
+    {
+        if (halt != Halt::NONE) {
+            return halt;
+        }
+
+        if (const std::optional<uint8_t> exception = exceptions.highestPending();
+            exception && (exceptions.priority(*exception) < executionPriority())) {
+            sleeping = false;
+            enterException(*exception, regs[PC]);
+            return halt;
+        }
+
+        if (sleeping) {
+            if (shouldWake()) {
+                sleeping = false;
+            } else if (!sys_tick.canInterrupt()) {
+                halt = Halt::DEADLOCK;
+            } else {
+                advance(1);
+            }
+
+            return halt;
+        }
+
+        execute();
+
+        if (scb.isResetRequested() && (halt == Halt::NONE)) {
+            halt = Halt::SYSTEM_RESET;
+        }
+
+        return halt;
+    }
+
+    bool Cpu::shouldWake()
+    {
+        // A pending exception wakes the core even if PRIMASK keeps it from being taken.
+        if (const std::optional<uint8_t> exception = exceptions.highestPending();
+            exception && (exceptions.priority(*exception) < exceptions.executionPriority(false))) {
+            return true;
+        }
+
+        if (sleeping_for_event && exceptions.event) {
+            exceptions.event = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    void Cpu::execute()
+    {
+        const uint32_t address = regs[PC];
+
+        // Executing with EPSR.T clear (e.g. after BX to an even address) is an INVSTATE fault.
+        if (!xpsr.bits.T) {
+            raiseHardFault(address);
+            return;
+        }
+
+        const uint16_t instr = static_cast<uint16_t>(load(address, 2));
+
+        if (faulted) {
+            faulted = false;
+            raiseHardFault(address);
+            return;
+        }
+
+        const bool wide = (instr >> 11) >= 0b11101;
+        const uint16_t hw2 = wide ? static_cast<uint16_t>(load(address + 2, 2)) : 0;
+
+        if (faulted) {
+            faulted = false;
+            raiseHardFault(address);
+            return;
+        }
+
+        if (trace) {
+            if (wide) {
+                std::fprintf(stderr, "%12llu %08x: %04x %04x\n", static_cast<unsigned long long>(cycles), address, instr, hw2);
+            } else {
+                std::fprintf(stderr, "%12llu %08x: %04x\n", static_cast<unsigned long long>(cycles), address, instr);
+            }
+        }
+
+        next_pc = address + (wide ? 4 : 2);
+        instr_cycles = 1;
+
+        if (wide) {
+            execute32(instr, hw2);
+        } else {
+            execute16(instr);
+        }
+
+        if (faulted) {
+            faulted = false;
+            raiseHardFault(address);
+            return;
+        }
+
+        if (halt != Halt::NONE) {
+            return;
+        }
+
+        ++retired;
+        regs[PC] = next_pc;
+        advance(instr_cycles);
+    }
+
+    void Cpu::setNZ(uint32_t result)
+    {
+        xpsr.bits.N = result >> 31;
+        xpsr.bits.Z = result == 0;
+    }
+
+    uint32_t Cpu::addWithCarry(uint32_t x, uint32_t y, bool carry_in)
+    {
+        const uint64_t unsigned_sum = uint64_t{x} + y + carry_in;
+        const uint32_t result = static_cast<uint32_t>(unsigned_sum);
+
+        setNZ(result);
+        xpsr.bits.C = (unsigned_sum >> 32) != 0;
+        xpsr.bits.V = (((x ^ result) & (y ^ result)) >> 31) != 0;
+        return result;
+    }
+
+    void Cpu::branchTo(uint32_t address)
+    {
+        next_pc = address;
+        instr_cycles = 3;
+    }
+
+    void Cpu::bxWritePc(uint32_t address)
+    {
+        if (isHandlerMode() && isExcReturn(address)) {
+            exceptionReturn(address);
+            return;
+        }
+
+        xpsr.bits.T = address & 1u;
+        next_pc = address & ~1u;
+    }
+
+    void Cpu::execute16(uint16_t instr)
+    {
+        const uint8_t rd = instr & 7u;
+        const uint8_t rn = (instr >> 3) & 7u;
+        const uint8_t rm = (instr >> 6) & 7u;
+        const uint32_t imm5 = (instr >> 6) & 0x1Fu;
+        const uint8_t r8 = (instr >> 8) & 7u;
+        const uint32_t imm8 = instr & 0xFFu;
+
+        switch (instr >> 11) {
+        case 0b00000: { // LSLS Rd, Rm, #imm5 (MOVS Rd, Rm when imm5 == 0)
+            const uint32_t value = regs[rn];
+
+            if (imm5 != 0) {
+                xpsr.bits.C = ArmCortex::isBitSet(value, static_cast<uint8_t>(32 - imm5));
+            }
+
+            regs[rd] = value << imm5;
+            setNZ(regs[rd]);
+            return;
+        }
+
+        case 0b00001: { // LSRS Rd, Rm, #imm5
+            const uint32_t shift = (imm5 == 0) ? 32 : imm5;
+            const uint32_t value = regs[rn];
+
+            xpsr.bits.C = ArmCortex::isBitSet(value, static_cast<uint8_t>(shift - 1));
+            regs[rd] = (shift == 32) ? 0 : (value >> shift);
+            setNZ(regs[rd]);
+            return;
+        }
+
+        case 0b00010: { // ASRS Rd, Rm, #imm5
+            const uint32_t shift = (imm5 == 0) ? 32 : imm5;
+            const int32_t value = static_cast<int32_t>(regs[rn]);
+
+            xpsr.bits.C = ArmCortex::isBitSet(static_cast<uint32_t>(value), static_cast<uint8_t>(shift - 1));
+            regs[rd] = static_cast<uint32_t>(value >> ((shift == 32) ? 31 : shift));
+            setNZ(regs[rd]);
+            return;
+        }
+
+        case 0b00011: { // ADDS/SUBS with register or 3-bit immediate
+            const uint32_t operand = ArmCortex::isBitSet(instr, 10) ? rm : regs[rm];
+
+            if (ArmCortex::isBitSet(instr, 9)) {
+                regs[rd] = addWithCarry(regs[rn], ~operand, true);
+            } else {
+                regs[rd] = addWithCarry(regs[rn], operand, false);
+            }
+
+            return;
+        }
+
+        case 0b00100: // MOVS Rd, #imm8
+            regs[r8] = imm8;
+            setNZ(imm8);
+            return;
+
+        case 0b00101: // CMP Rn, #imm8
+            addWithCarry(regs[r8], ~imm8, true);
+            return;
+
+        case 0b00110: // ADDS Rdn, #imm8
+            regs[r8] = addWithCarry(regs[r8], imm8, false);
+            return;
+
+        case 0b00111: // SUBS Rdn, #imm8
+            regs[r8] = addWithCarry(regs[r8], ~imm8, true);
+            return;
+
+        case 0b01000:
+            if (ArmCortex::isBitSet(instr, 10)) {
+                executeSpecial(instr);
+            } else {
+                executeDataProcessing(instr);
+            }
+
+            return;
+
+        case 0b01001: // LDR Rt, [PC, #imm8 * 4]
+            regs[r8] = load(((regs[PC] + 4) & ~3u) + (imm8 * 4), 4);
+            instr_cycles = 2;
+            return;
+
+        case 0b01010:
+        case 0b01011: { // Load/store with register offset
+            const uint32_t address = regs[rn] + regs[rm];
+            instr_cycles = 2;
+
+            switch ((instr >> 9) & 7u) {
+            case 0: store(address, regs[rd], 4); return;
+            case 1: store(address, regs[rd], 2); return;
+            case 2: store(address, regs[rd], 1); return;
+            case 3: regs[rd] = signExtend(load(address, 1), 8); return;
+            case 4: regs[rd] = load(address, 4); return;
+            case 5: regs[rd] = load(address, 2); return;
+            case 6: regs[rd] = load(address, 1); return;
+            default: regs[rd] = signExtend(load(address, 2), 16); return;
+            }
+        }
+
+        case 0b01100: // STR Rt, [Rn, #imm5 * 4]
+            store(regs[rn] + (imm5 * 4), regs[rd], 4);
+            instr_cycles = 2;
+            return;
+
+        case 0b01101: // LDR Rt, [Rn, #imm5 * 4]
+            regs[rd] = load(regs[rn] + (imm5 * 4), 4);
+            instr_cycles = 2;
+            return;
+
+        case 0b01110: // STRB Rt, [Rn, #imm5]
+            store(regs[rn] + imm5, regs[rd], 1);
+            instr_cycles = 2;
+            return;
+
+        case 0b01111: // LDRB Rt, [Rn, #imm5]
+            regs[rd] = load(regs[rn] + imm5, 1);
+            instr_cycles = 2;
+            return;
+
+        case 0b10000: // STRH Rt, [Rn, #imm5 * 2]
+            store(regs[rn] + (imm5 * 2), regs[rd], 2);
+            instr_cycles = 2;
+            return;
+
+        case 0b10001: // LDRH Rt, [Rn, #imm5 * 2]
+            regs[rd] = load(regs[rn] + (imm5 * 2), 2);
+            instr_cycles = 2;
+            return;
+
+        case 0b10010: // STR Rt, [SP, #imm8 * 4]
+            store(sp() + (imm8 * 4), regs[r8], 4);
+            instr_cycles = 2;
+            return;
+
+        case 0b10011: // LDR Rt, [SP, #imm8 * 4]
+            regs[r8] = load(sp() + (imm8 * 4), 4);
+            instr_cycles = 2;
+            return;
+
+        case 0b10100: // ADR Rd, label
+            regs[r8] = ((regs[PC] + 4) & ~3u) + (imm8 * 4);
+            return;
+
+        case 0b10101: // ADD Rd, SP, #imm8 * 4
+            regs[r8] = sp() + (imm8 * 4);
+            return;
+
+        case 0b10110:
+        case 0b10111:
+            executeMisc(instr);
+            return;
+
+        case 0b11000: { // STM Rn!, {registers}
+            uint32_t address = regs[r8];
+
+            for (uint8_t n = 0; n < 8; ++n) {
+                if (ArmCortex::isBitSet(imm8, n)) {
+                    store(address, regs[n], 4);
+                    address += 4;
+                }
+            }
+
+            regs[r8] = address;
+            instr_cycles = 1 + bitCount(imm8);
+            return;
+        }
+
+        case 0b11001: { // LDM Rn!, {registers}
+            uint32_t address = regs[r8];
+
+            for (uint8_t n = 0; n < 8; ++n) {
+                if (ArmCortex::isBitSet(imm8, n)) {
+                    regs[n] = load(address, 4);
+                    address += 4;
+                }
+            }
+
+            if (!ArmCortex::isBitSet(imm8, r8)) {
+                regs[r8] = address;
+            }
+
+            instr_cycles = 1 + bitCount(imm8);
+            return;
+        }
+
+        case 0b11010:
+        case 0b11011: { // B<cond>, UDF, SVC
+            const uint8_t cond = (instr >> 8) & 0xFu;
+
+            if (cond == 0b1110) {
+                break;
+            }
+
+            if (cond == 0b1111) {
+                if (exceptions.priority(SV_CALL) >= executionPriority()) {
+                    // SVC with insufficient priority escalates to HardFault.
+                    faulted = true;
+                    return;
+                }
+
+                exceptions.setPending(SV_CALL);
+                enterException(SV_CALL, next_pc);
+                next_pc = regs[PC];
+                return;
+            }
+
+            const bool n = xpsr.bits.N;
+            const bool z = xpsr.bits.Z;
+            const bool c = xpsr.bits.C;
+            const bool v = xpsr.bits.V;
+            bool taken = false;
+
+            switch (cond >> 1) {
+            case 0: taken = z; break;
+            case 1: taken = c; break;
+            case 2: taken = n; break;
+            case 3: taken = v; break;
+            case 4: taken = c && !z; break;
+            case 5: taken = n == v; break;
+            case 6: taken = !z && (n == v); break;
+            default: taken = true; break;
+            }
+
+            if (ArmCortex::isBitSet(cond, 0)) {
+                taken = !taken;
+            }
+
+            if (taken) {
+                branchTo(regs[PC] + 4 + signExtend(imm8 << 1, 9));
+            }
+
+            return;
+        }
+
+        case 0b11100: // B label
+            branchTo(regs[PC] + 4 + signExtend((instr & 0x7FFu) << 1, 12));
+            return;
+
+        default:
+            break;
+        }
+
+        undefined();
+    }
+
+    void Cpu::executeDataProcessing(uint16_t instr)
+    {
+        const uint8_t rdn = instr & 7u;
+        const uint8_t rm = (instr >> 3) & 7u;
+        const uint32_t a = regs[rdn];
+        const uint32_t b = regs[rm];
+
+        switch ((instr >> 6) & 0xFu) {
+        case 0x0: // ANDS
+            regs[rdn] = a & b;
+            setNZ(regs[rdn]);
+            return;
+
+        case 0x1: // EORS
+            regs[rdn] = a ^ b;
+            setNZ(regs[rdn]);
+            return;
+
+        case 0x2: { // LSLS Rdn, Rm
+            const uint32_t shift = b & 0xFFu;
+
+            if ((shift > 0) && (shift <= 32)) {
+                xpsr.bits.C = ArmCortex::isBitSet(a, static_cast<uint8_t>(32 - shift));
+            } else if (shift > 32) {
+                xpsr.bits.C = 0;
+            }
+
+            regs[rdn] = (shift >= 32) ? 0 : (a << shift);
+            setNZ(regs[rdn]);
+            return;
+        }
+
+        case 0x3: { // LSRS Rdn, Rm
+            const uint32_t shift = b & 0xFFu;
+
+            if ((shift > 0) && (shift <= 32)) {
+                xpsr.bits.C = ArmCortex::isBitSet(a, static_cast<uint8_t>(shift - 1));
+            } else if (shift > 32) {
+                xpsr.bits.C = 0;
+            }
+
+            regs[rdn] = (shift >= 32) ? 0 : (a >> shift);
+            setNZ(regs[rdn]);
+            return;
+        }
+
+        case 0x4: { // ASRS Rdn, Rm
+            const uint32_t shift = b & 0xFFu;
+
+            if (shift > 0) {
+                xpsr.bits.C = ArmCortex::isBitSet(a, static_cast<uint8_t>((shift >= 32) ? 31 : (shift - 1)));
+            }
+
+            regs[rdn] = static_cast<uint32_t>(static_cast<int32_t>(a) >> ((shift >= 32) ? 31 : shift));
+            setNZ(regs[rdn]);
+            return;
+        }
+
+        case 0x5: // ADCS
+            regs[rdn] = addWithCarry(a, b, xpsr.bits.C);
+            return;
+
+        case 0x6: // SBCS
+            regs[rdn] = addWithCarry(a, ~b, xpsr.bits.C);
+            return;
+
+        case 0x7: { // RORS
+            const uint32_t shift = b & 0xFFu;
+
+            if (shift > 0) {
+                const uint32_t rotate = shift % 32;
+                regs[rdn] = (rotate == 0) ? a : ((a >> rotate) | (a << (32 - rotate)));
+                xpsr.bits.C = regs[rdn] >> 31;
+            }
+
+            setNZ(regs[rdn]);
+            return;
+        }
+
+        case 0x8: // TST
+            setNZ(a & b);
+            return;
+
+        case 0x9: // RSBS Rd, Rn, #0
+            regs[rdn] = addWithCarry(~b, 0, true);
+            return;
+
+        case 0xA: // CMP
+            addWithCarry(a, ~b, true);
+            return;
+
+        case 0xB: // CMN
+            addWithCarry(a, b, false);
+            return;
+
+        case 0xC: // ORRS
+            regs[rdn] = a | b;
+            setNZ(regs[rdn]);
+            return;
+
+        case 0xD: // MULS (single-cycle multiplier)
+            regs[rdn] = a * b;
+            setNZ(regs[rdn]);
+            return;
+
+        case 0xE: // BICS
+            regs[rdn] = a & ~b;
+            setNZ(regs[rdn]);
+            return;
+
+        default: // MVNS
+            regs[rdn] = ~b;
+            setNZ(regs[rdn]);
+            return;
+        }
+    }
+
+    void Cpu::executeSpecial(uint16_t instr)
+    {
+        const uint8_t rdn = static_cast<uint8_t>(((instr >> 4) & 8u) | (instr & 7u));
+        const uint8_t rm = (instr >> 3) & 0xFu;
+
+        switch ((instr >> 8) & 3u) {
+        case 0: // ADD Rdn, Rm
+            writeReg(rdn, readReg(rdn) + readReg(rm));
+            return;
+
+        case 1: // CMP Rn, Rm
+            addWithCarry(readReg(rdn), ~readReg(rm), true);
+            return;
+
+        case 2: // MOV Rd, Rm
+            writeReg(rdn, readReg(rm));
+            return;
+
+        default: { // BX Rm / BLX Rm
+            const uint32_t target = readReg(rm);
+
+            if (ArmCortex::isBitSet(instr, 7)) {
+                regs[LR] = next_pc | 1u;
+            }
+
+            instr_cycles = 3;
+            bxWritePc(target);
+            return;
+        }
+        }
+    }
+
+    void Cpu::executeMisc(uint16_t instr)
+    {
+        const uint8_t rd = instr & 7u;
+        const uint8_t rm = (instr >> 3) & 7u;
+        const uint32_t imm8 = instr & 0xFFu;
+
+        switch ((instr >> 8) & 0xFu) {
+        case 0x0: // ADD/SUB SP, SP, #imm7 * 4
+            if (ArmCortex::isBitSet(instr, 7)) {
+                setSp(sp() - ((instr & 0x7Fu) * 4));
+            } else {
+                setSp(sp() + ((instr & 0x7Fu) * 4));
+            }
+
+            return;
+
+        case 0x2: { // SXTH, SXTB, UXTH, UXTB
+            const uint32_t value = regs[rm];
+
+            switch ((instr >> 6) & 3u) {
+            case 0: regs[rd] = signExtend(value & 0xFFFFu, 16); return;
+            case 1: regs[rd] = signExtend(value & 0xFFu, 8); return;
+            case 2: regs[rd] = value & 0xFFFFu; return;
+            default: regs[rd] = value & 0xFFu; return;
+            }
+        }
+
+        case 0x4:
+        case 0x5: { // PUSH {registers, LR}
+            const uint32_t count = bitCount(imm8) + (ArmCortex::isBitSet(instr, 8) ? 1 : 0);
+            uint32_t address = sp() - (count * 4);
+            const uint32_t new_sp = address;
+
+            for (uint8_t n = 0; n < 8; ++n) {
+                if (ArmCortex::isBitSet(imm8, n)) {
+                    store(address, regs[n], 4);
+                    address += 4;
+                }
+            }
+
+            if (ArmCortex::isBitSet(instr, 8)) {
+                store(address, regs[LR], 4);
+            }
+
+            if (!faulted) {
+                setSp(new_sp);
+            }
+
+            instr_cycles = 1 + count;
+            return;
+        }
+
+        case 0x6: // CPSIE i / CPSID i
+            if ((instr & 0xFFEFu) == 0xB662u) {
+                primask.bits.PRIMASK = ArmCortex::isBitSet(instr, 4);
+                return;
+            }
+
+            break;
+
+        case 0xA: { // REV, REV16, REVSH
+            const uint32_t value = regs[rm];
+
+            switch ((instr >> 6) & 3u) {
+            case 0:
+                regs[rd] = __builtin_bswap32(value);
+                return;
+
+            case 1:
+                regs[rd] = ((value & 0x00FF00FFu) << 8) | ((value & 0xFF00FF00u) >> 8);
+                return;
+
+            case 3:
+                regs[rd] = signExtend(((value & 0xFFu) << 8) | ((value >> 8) & 0xFFu), 16);
+                return;
+
+            default:
+                break;
+            }
+
+            break;
+        }
+
+        case 0xC:
+        case 0xD: { // POP {registers, PC}
+            const bool pops_pc = ArmCortex::isBitSet(instr, 8);
+            const uint32_t count = bitCount(imm8) + (pops_pc ? 1 : 0);
+            uint32_t address = sp();
+
+            for (uint8_t n = 0; n < 8; ++n) {
+                if (ArmCortex::isBitSet(imm8, n)) {
+                    regs[n] = load(address, 4);
+                    address += 4;
+                }
+            }
+
+            const uint32_t target = pops_pc ? load(address, 4) : 0;
+
+            if (faulted) {
+                return;
+            }
+
+            setSp(address + (pops_pc ? 4 : 0));
+            instr_cycles = pops_pc ? (4 + bitCount(imm8)) : (1 + count);
+
+            if (pops_pc) {
+                bxWritePc(target);
+            }
+
+            return;
+        }
+
+        case 0xE: // BKPT #imm8
+            if (imm8 == SEMIHOSTING_BKPT) {
+                semihosting();
+            } else {
+                halt = Halt::BREAKPOINT;
+            }
+
+            return;
+
+        case 0xF: // Hints
+            if ((instr & 0xFu) != 0) {
+                break;
+            }
+
+            switch ((instr >> 4) & 0xFu) {
+            case 0: // NOP
+            case 1: // YIELD
+                return;
+
+            case 2: // WFE
+                instr_cycles = 2;
+
+                if (exceptions.event) {
+                    exceptions.event = false;
+                } else {
+                    sleeping = true;
+                    sleeping_for_event = true;
+                }
+
+                return;
+
+            case 3: // WFI
+                instr_cycles = 2;
+                sleeping = true;
+                sleeping_for_event = false;
+                return;
+
+            case 4: // SEV
+                exceptions.event = true;
+                return;
+
+            default:
+                return;
+            }
+
+        default:
+            break;
+        }
+
+        undefined();
+    }
+
+    void Cpu::execute32(uint16_t hw1, uint16_t hw2)
+    {
+        if ((hw1 >> 11) == 0b11110) {
+            if ((hw2 & 0xD000u) == 0xD000u) { // BL label
+                const uint32_t s = (hw1 >> 10) & 1u;
+                const uint32_t i1 = ~((hw2 >> 13) ^ s) & 1u;
+                const uint32_t i2 = ~((hw2 >> 11) ^ s) & 1u;
+                const uint32_t offset = (s << 24) | (i1 << 23) | (i2 << 22) | ((hw1 & 0x3FFu) << 12) | ((hw2 & 0x7FFu) << 1);
+
+                regs[LR] = next_pc | 1u;
+                branchTo(regs[PC] + 4 + signExtend(offset, 25));
+                instr_cycles = 4;
+                return;
+            }
+
+            if ((hw2 & 0xD000u) == 0x8000u) {
+                instr_cycles = 4;
+
+                if ((hw1 & 0xFFF0u) == 0xF380u) { // MSR spec_reg, Rn
+                    writeSpecial(hw2 & 0xFFu, readReg(hw1 & 0xFu));
+                    return;
+                }
+
+                if (hw1 == 0xF3EFu) { // MRS Rd, spec_reg
+                    writeReg((hw2 >> 8) & 0xFu, readSpecial(hw2 & 0xFFu));
+                    return;
+                }
+
+                if ((hw1 == 0xF3BFu) && ((hw2 & 0xFFC0u) == 0x8F40u)) { // DSB, DMB, ISB
+                    return;
+                }
+            }
+        }
+
+        undefined();
+    }
+
+    uint32_t Cpu::readSpecial(uint8_t sysm) const
+    {
+        if (sysm < 8) {
+            PSR value;
+
+            if (ArmCortex::isBitSet(sysm, 0)) {
+                value.bits.ISR = exceptions.current;
+            }
+
+            if (!ArmCortex::isBitSet(sysm, 2)) {
+                value.bits.N = xpsr.bits.N;
+                value.bits.Z = xpsr.bits.Z;
+                value.bits.C = xpsr.bits.C;
+                value.bits.V = xpsr.bits.V;
+            }
+
+            // EPSR.T reads as zero.
+            return value.value;
+        }
+
+        switch (sysm) {
+        case SYSM_MSP: return msp;
+        case SYSM_PSP: return psp;
+        case SYSM_PRIMASK: return primask.value;
+        case SYSM_CONTROL: return control.value;
+        default: return 0;
+        }
+    }
+
+    void Cpu::writeSpecial(uint8_t sysm, uint32_t value)
+    {
+        if (sysm < 8) {
+            if (!ArmCortex::isBitSet(sysm, 2)) {
+                const PSR written { value };
+                xpsr.bits.N = written.bits.N;
+                xpsr.bits.Z = written.bits.Z;
+                xpsr.bits.C = written.bits.C;
+                xpsr.bits.V = written.bits.V;
+            }
+
+            return;
+        }
+
+        switch (sysm) {
+        case SYSM_MSP:
+            msp = value & ~3u;
+            break;
+
+        case SYSM_PSP:
+            psp = value & ~3u;
+            break;
+
+        case SYSM_PRIMASK:
+            primask.bits.PRIMASK = value & 1u;
+            break;
+
+        case SYSM_CONTROL:
+            // SPSEL can only be changed in Thread mode.
+            if (!isHandlerMode()) {
+                control.bits.SPSEL = CONTROL { value }.bits.SPSEL;
+            }
+
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    void Cpu::semihosting()
+    {
+        const uint32_t operation = regs[0];
+        const uint32_t parameter = regs[1];
+
+        switch (operation) {
+        case SYS_WRITEC:
+            std::fputc(static_cast<int>(load(parameter, 1)), stdout);
+            return;
+
+        case SYS_WRITE0:
+            for (uint32_t address = parameter; !faulted; ++address) {
+                const uint32_t character = load(address, 1);
+
+                if (character == 0) {
+                    break;
+                }
+
+                std::fputc(static_cast<int>(character), stdout);
+            }
+
+            return;
+
+        case SYS_WRITE: {
+            const uint32_t handle = load(parameter, 4);
+            const uint32_t data = load(parameter + 4, 4);
+            const uint32_t length = load(parameter + 8, 4);
+            std::FILE* stream = (handle == 2) ? stderr : stdout;
+
+            for (uint32_t index = 0; (index < length) && !faulted; ++index) {
+                std::fputc(static_cast<int>(load(data + index, 1)), stream);
+            }
+
+            regs[0] = 0;
+            return;
+        }
+
+        case SYS_EXIT:
+            exit_code = (parameter == ADP_STOPPED_APPLICATION_EXIT) ? 0 : 1;
+            halt = Halt::EXIT;
+            return;
+
+        case SYS_EXIT_EXTENDED:
+            exit_code = (load(parameter, 4) == ADP_STOPPED_APPLICATION_EXIT) ? static_cast<int>(load(parameter + 4, 4)) : 1;
+            halt = Halt::EXIT;
+            return;
+
+        default:
+            regs[0] = UINT32_MAX;
+            return;
+        }
+    }
+
+    void Cpu::undefined()
+    {
+        faulted = true;
+    }
+
+    // =========================================================================
+    // Exceptions
+    // =========================================================================
+
+    void Cpu::raiseHardFault(uint32_t return_address)
+    {
+        if (executionPriority() <= exceptions.priority(HARD_FAULT)) {
+            halt = Halt::LOCKUP;
+            return;
+        }
+
+        exceptions.setPending(HARD_FAULT);
+        enterException(HARD_FAULT, return_address);
+    }
+
+    void Cpu::enterException(uint8_t exception, uint32_t return_address)
+    {
+        // Stack R0-R3, R12, LR, return address and xPSR on the current stack, 8-byte aligned.
+        const uint32_t frame_sp = sp();
+        const bool realign = ArmCortex::isBitSet(frame_sp, 2);
+        const uint32_t frame = (frame_sp - FRAME_SIZE) & ~7u;
+
+        PSR stacked = xpsr;
+        stacked.bits.ISR = exceptions.current;
+
+        if (realign) {
+            ArmCortex::setBit(stacked.value, STACK_ALIGN_BIT);
+        }
+
+        const std::array<uint32_t, 8> words {
+            regs[0], regs[1], regs[2], regs[3], regs[12], regs[LR], return_address, stacked.value
+        };
+
+        for (uint32_t index = 0; index < words.size(); ++index) {
+            if (!bus.write(frame + (index * 4), words[index], 4)) {
+                halt = Halt::LOCKUP;
+                return;
+            }
+        }
+
+        setSp(frame);
+
+        LrExceptionReturnValue exc_return = LrExceptionReturnValue::HANDLER;
+
+        if (!isHandlerMode()) {
+            exc_return = (control.bits.SPSEL == static_cast<uint32_t>(CONTROL::SPSEL::PSP))
+                ? LrExceptionReturnValue::THREAD_PSP
+                : LrExceptionReturnValue::THREAD_MSP;
+        }
+
+        regs[LR] = static_cast<uint32_t>(exc_return);
+        control.bits.SPSEL = static_cast<uint32_t>(CONTROL::SPSEL::MSP);
+
+        exceptions.clearPending(exception);
+        exceptions.setActive(exception, true);
+        exceptions.current = exception;
+
+        // Exception entry sets the event register as well as exception return.
+        exceptions.event = true;
+
+        const std::optional<uint32_t> vector = bus.read(exception * 4u, 4);
+
+        if (!vector) {
+            halt = Halt::LOCKUP;
+            return;
+        }
+
+        xpsr.bits.T = *vector & 1u;
+        regs[PC] = *vector & ~1u;
+        advance(ENTRY_CYCLES);
+
+        ExceptionProfile& profile = profiles[exception];
+        const uint64_t latency = cycles - exceptions.pendingSince(exception);
+        ++profile.count;
+        profile.latency_total += latency;
+        profile.latency_min = (latency < profile.latency_min) ? latency : profile.latency_min;
+        profile.latency_max = (latency > profile.latency_max) ? latency : profile.latency_max;
+        profile.entered_at = cycles;
+    }
+
+    void Cpu::exceptionReturn(uint32_t exc_return)
+    {
+        const uint8_t returning = exceptions.current;
+        const auto kind = static_cast<LrExceptionReturnValue>(exc_return);
+
+        if ((kind != LrExceptionReturnValue::HANDLER) && (kind != LrExceptionReturnValue::THREAD_MSP) &&
+            (kind != LrExceptionReturnValue::THREAD_PSP)) {
+            faulted = true;
+            return;
+        }
+
+        const uint32_t frame = (kind == LrExceptionReturnValue::THREAD_PSP) ? psp : msp;
+        std::array<uint32_t, 8> words {};
+
+        for (uint32_t index = 0; index < words.size(); ++index) {
+            const std::optional<uint32_t> word = bus.read(frame + (index * 4), 4);
+
+            if (!word) {
+                halt = Halt::LOCKUP;
+                return;
+            }
+
+            words[index] = *word;
+        }
+
+        const PSR stacked { words[7] };
+        const uint32_t new_sp = (frame + FRAME_SIZE) | (ArmCortex::isBitSet(stacked.value, STACK_ALIGN_BIT) ? 4u : 0u);
+
+        exceptions.setActive(returning, false);
+
+        if (kind == LrExceptionReturnValue::THREAD_PSP) {
+            psp = new_sp;
+            control.bits.SPSEL = static_cast<uint32_t>(CONTROL::SPSEL::PSP);
+        } else {
+            msp = new_sp;
+            control.bits.SPSEL = static_cast<uint32_t>(CONTROL::SPSEL::MSP);
+        }
+
+        regs[0] = words[0];
+        regs[1] = words[1];
+        regs[2] = words[2];
+        regs[3] = words[3];
+        regs[12] = words[4];
+        regs[LR] = words[5];
+
+        xpsr.bits.N = stacked.bits.N;
+        xpsr.bits.Z = stacked.bits.Z;
+        xpsr.bits.C = stacked.bits.C;
+        xpsr.bits.V = stacked.bits.V;
+        xpsr.bits.T = stacked.bits.T;
+        exceptions.current = (kind == LrExceptionReturnValue::HANDLER) ? static_cast<uint8_t>(stacked.bits.ISR & 0x3Fu) : 0;
+
+        // An exception return sets the event register, waking a WFE in the interrupted code.
+        exceptions.event = true;
+
+        next_pc = words[6] & ~1u;
+        instr_cycles += EXIT_CYCLES;
+
+        ExceptionProfile& profile = profiles[returning];
+        profile.handler_cycles += cycles + instr_cycles - profile.entered_at;
+
+        if ((kind != LrExceptionReturnValue::HANDLER) && scb.sleepOnExit()) {
+            sleeping = true;
+            sleeping_for_event = false;
+        }
+    }
+}
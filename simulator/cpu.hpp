@@ -0,0 +1,133 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include "./bus.hpp"
+#include "./peripherals.hpp"
+#include <arm-cortex-m0-core/special_regs.hpp>
+#include <array>
+#include <cstdint>
+
+namespace ArmCortex::Simulator {
+    //! Reason the core stopped executing.
+    enum class Halt : uint8_t {
+        NONE, //!< Still running.
+        EXIT, //!< Semihosting SYS_EXIT.
+        BREAKPOINT, //!< BKPT other than a semihosting call.
+        LOCKUP, //!< Fault while in NMI or HardFault, or fault during exception entry/return.
+        SYSTEM_RESET, //!< AIRCR.SYSRESETREQ written.
+        DEADLOCK, //!< Sleeping with no enabled wake-up source.
+        CYCLE_LIMIT //!< Cycle budget exhausted.
+    };
+
+    //! Per-exception timing statistics.
+    struct ExceptionProfile {
+        uint64_t count = 0; //!< Number of times the handler was entered.
+        uint64_t latency_total = 0; //!< Sum of cycles from pending to the first handler instruction.
+        uint64_t latency_min = UINT64_MAX;
+        uint64_t latency_max = 0;
+        uint64_t handler_cycles = 0; //!< Cycles from entry to return, including nested exceptions and exit.
+        uint64_t entered_at = 0;
+    };
+
+    //! ARMv6-M (Thumb-1) core with Cortex-M0 instruction timings and zero wait-state memory.
+    class Cpu {
+    public:
+        static constexpr uint32_t ENTRY_CYCLES = 16; //!< Exception entry: stacking and vector fetch.
+        static constexpr uint32_t EXIT_CYCLES = 16; //!< Exception return: unstacking, added to the returning instruction.
+        static constexpr uint16_t SEMIHOSTING_BKPT = 0xAB; //!< BKPT immediate used for semihosting calls.
+
+        Cpu(Bus& bus, ExceptionState& exceptions, ScbModel& scb, SysTickModel& sys_tick, uint64_t& cycles);
+
+        //! Reset the core, loading MSP and the entry point from the vector table at address 0.
+        void reset();
+
+        //! Take a pending exception, execute one instruction or sleep for one cycle.
+        Halt step();
+
+        //! Stop with the given reason (e.g. when the cycle budget runs out).
+        void stop(Halt reason) { halt = reason; }
+        Halt halted() const { return halt; }
+
+        uint32_t reg(uint8_t n) const;
+        uint32_t pc() const { return regs[15]; }
+        uint64_t instructions() const { return retired; }
+        int exitCode() const { return exit_code; }
+        const std::array<ExceptionProfile, NUM_OF_EXCEPTIONS>& profile() const { return profiles; }
+
+        bool trace = false; //!< Print every executed instruction to stderr.
+
+    private:
+        bool isHandlerMode() const { return exceptions.current != 0; }
+        int executionPriority() const;
+
+        uint32_t sp() const;
+        void setSp(uint32_t value);
+        uint32_t readReg(uint8_t n) const;
+        void writeReg(uint8_t n, uint32_t value);
+
+        uint32_t load(uint32_t address, uint32_t size);
+        void store(uint32_t address, uint32_t value, uint32_t size);
+
+        void advance(uint32_t count);
+        void execute();
+        void execute16(uint16_t instr);
+        void execute32(uint16_t hw1, uint16_t hw2);
+        void executeSpecial(uint16_t instr);
+        void executeMisc(uint16_t instr);
+        void executeDataProcessing(uint16_t instr);
+
+        void setNZ(uint32_t result);
+        uint32_t addWithCarry(uint32_t x, uint32_t y, bool carry_in);
+        void branchTo(uint32_t address);
+        void bxWritePc(uint32_t address);
+
+        uint32_t readSpecial(uint8_t sysm) const;
+        void writeSpecial(uint8_t sysm, uint32_t value);
+
+        void semihosting();
+        void undefined();
+        void raiseHardFault(uint32_t return_address);
+        void enterException(uint8_t exception, uint32_t return_address);
+        void exceptionReturn(uint32_t exc_return);
+        bool shouldWake();
+
+        Bus& bus;
+        ExceptionState& exceptions;
+        ScbModel& scb;
+        SysTickModel& sys_tick;
+        uint64_t& cycles;
+
+        std::array<uint32_t, 16> regs {}; //!< R0-R12, unused SP slot, LR, address of the current instruction.
+        uint32_t msp = 0;
+        uint32_t psp = 0;
+        PSR xpsr; //!< APSR flags and EPSR.T; IPSR lives in ExceptionState::current.
+        PRIMASK primask;
+        CONTROL control;
+
+        uint32_t next_pc = 0;
+        uint32_t instr_cycles = 0;
+        bool faulted = false;
+        bool sleeping = false;
+        bool sleeping_for_event = false;
+
+        Halt halt = Halt::NONE;
+        int exit_code = 0;
+        uint64_t retired = 0;
+        std::array<ExceptionProfile, NUM_OF_EXCEPTIONS> profiles {};
+    };
+}
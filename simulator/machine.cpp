@@ -0,0 +1,199 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "./machine.hpp"
+
+#include <arm-cortex-m0-core/nvic.hpp>
+#include <arm-cortex-m0-core/scb.hpp>
+#include <arm-cortex-m0-core/systick.hpp>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace ArmCortex::Simulator {
+    namespace {
+        constexpr uint32_t PT_LOAD = 1;
+        constexpr uint16_t EM_ARM = 40;
+
+        std::vector<uint8_t> readFile(const std::string& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        template<typename T>
+        T readLe(const std::vector<uint8_t>& data, size_t offset)
+        {
+            T value = 0;
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            return value;
+        }
+
+        const char* haltName(Halt halt)
+        {
+            switch (halt) {
+            case Halt::NONE: return "running";
+            case Halt::EXIT: return "exit";
+            case Halt::BREAKPOINT: return "breakpoint";
+            case Halt::LOCKUP: return "lockup";
+            case Halt::SYSTEM_RESET: return "system reset request";
+            case Halt::DEADLOCK: return "sleeping with no wake-up source";
+            case Halt::CYCLE_LIMIT: return "cycle limit";
+            }
+
+            return "unknown";
+        }
+
+        const char* exceptionName(uint8_t exception)
+        {
+            switch (static_cast<ExceptionNumber>(exception)) {
+            case ExceptionNumber::NMI: return "NMI";
+            case ExceptionNumber::HARD_FAULT: return "HardFault";
+            case ExceptionNumber::SV_CALL: return "SVCall";
+            case ExceptionNumber::PEND_SV: return "PendSV";
+            case ExceptionNumber::SYS_TICK: return "SysTick";
+            default: return "IRQ";
+            }
+        }
+    }
+
+    Machine::Machine(uint32_t flash_size, uint32_t ram_size)
+        : bus(flash_size, ram_size), exceptions(cycles), nvic(exceptions), scb(exceptions), sys_tick(exceptions),
+          cpu(bus, exceptions, scb, sys_tick, cycles)
+    {
+        bus.map(Nvic::BASE_ADDRESS, sizeof(Nvic::Registers), nvic);
+        bus.map(Scb::BASE_ADDRESS, sizeof(Scb::Registers), scb);
+        bus.map(SysTick::BASE_ADDRESS, sizeof(SysTick::Registers), sys_tick);
+    }
+
+    std::string Machine::loadElf(const std::string& path)
+    {
+        const std::vector<uint8_t> data = readFile(path);
+
+        // ELF32, little-endian, ARM.
+        if ((data.size() < 52) || (std::memcmp(data.data(), "\x7F" "ELF", 4) != 0) || (data[4] != 1) || (data[5] != 1)) {
+            return "not a little-endian ELF32 file: " + path;
+        }
+
+        if (readLe<uint16_t>(data, 18) != EM_ARM) {
+            return "not an ARM executable: " + path;
+        }
+
+        const uint32_t phoff = readLe<uint32_t>(data, 28);
+        const uint16_t phentsize = readLe<uint16_t>(data, 42);
+        const uint16_t phnum = readLe<uint16_t>(data, 44);
+
+        for (uint16_t index = 0; index < phnum; ++index) {
+            const size_t header = size_t{phoff} + (size_t{index} * phentsize);
+
+            if (header + 32 > data.size()) {
+                return "truncated program header table: " + path;
+            }
+
+            if (readLe<uint32_t>(data, header) != PT_LOAD) {
+                continue;
+            }
+
+            const uint32_t offset = readLe<uint32_t>(data, header + 4);
+            const uint32_t paddr = readLe<uint32_t>(data, header + 12);
+            const uint32_t filesz = readLe<uint32_t>(data, header + 16);
+            const uint32_t memsz = readLe<uint32_t>(data, header + 20);
+
+            if (size_t{offset} + filesz > data.size()) {
+                return "truncated segment: " + path;
+            }
+
+            // Zero-fill the part of the segment that is not in the file (.bss).
+            std::vector<uint8_t> segment(data.begin() + offset, data.begin() + offset + filesz);
+            segment.resize(memsz, 0);
+
+            if (!bus.load(paddr, segment.data(), segment.size())) {
+                return "segment outside flash and SRAM: " + path;
+            }
+        }
+
+        return {};
+    }
+
+    std::string Machine::loadBinary(const std::string& path)
+    {
+        const std::vector<uint8_t> data = readFile(path);
+
+        if (data.empty()) {
+            return "empty or unreadable image: " + path;
+        }
+
+        if (!bus.load(Bus::FLASH_BASE, data.data(), data.size())) {
+            return "image larger than flash: " + path;
+        }
+
+        return {};
+    }
+
+    void Machine::reset()
+    {
+        cycles = 0;
+        cpu.reset();
+    }
+
+    Halt Machine::run(uint64_t max_cycles)
+    {
+        Halt halt = Halt::NONE;
+
+        while (halt == Halt::NONE) {
+            if (cycles >= max_cycles) {
+                cpu.stop(Halt::CYCLE_LIMIT);
+            }
+
+            halt = cpu.step();
+        }
+
+        return halt;
+    }
+
+    void Machine::printReport(std::FILE* stream) const
+    {
+        std::fprintf(stream, "halt: %s at pc 0x%08x\n", haltName(cpu.halted()), cpu.pc());
+        std::fprintf(stream, "cycles: %llu\n", static_cast<unsigned long long>(cycles));
+        std::fprintf(stream, "instructions: %llu\n", static_cast<unsigned long long>(cpu.instructions()));
+
+        bool header = false;
+
+        for (uint8_t exception = 1; exception < NUM_OF_EXCEPTIONS; ++exception) {
+            const ExceptionProfile& profile = cpu.profile()[exception];
+
+            if (profile.count == 0) {
+                continue;
+            }
+
+            if (!header) {
+                std::fprintf(stream, "%-14s %8s %28s %16s\n", "exception", "count", "latency min/avg/max", "handler avg");
+                header = true;
+            }
+
+            char name[16];
+            std::snprintf(name, sizeof(name), "%u %s", exception, exceptionName(exception));
+
+            std::fprintf(stream, "%-14s %8llu %8llu/%9llu/%9llu %16llu\n", name,
+                static_cast<unsigned long long>(profile.count),
+                static_cast<unsigned long long>(profile.latency_min),
+                static_cast<unsigned long long>(profile.latency_total / profile.count),
+                static_cast<unsigned long long>(profile.latency_max),
+                static_cast<unsigned long long>(profile.handler_cycles / profile.count));
+        }
+    }
+}
@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include "./bus.hpp"
+#include "./cpu.hpp"
+#include "./peripherals.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace ArmCortex::Simulator {
+    //! Cortex-M0 system: core, flash, SRAM and the NVIC, SCB and SysTick models at their architectural addresses.
+    class Machine {
+    public:
+        Machine(uint32_t flash_size, uint32_t ram_size);
+
+        //! Load an ELF32 executable (PT_LOAD segments at their physical addresses) or a raw flash image.
+        //! \return Empty string on success, otherwise an error description.
+        std::string loadElf(const std::string& path);
+        std::string loadBinary(const std::string& path);
+
+        void reset();
+
+        //! Run until the core halts or `max_cycles` elapse.
+        Halt run(uint64_t max_cycles);
+
+        //! Print cycle counts and per-exception latency and handler statistics.
+        void printReport(std::FILE* stream) const;
+
+        uint64_t cycles = 0;
+        Bus bus;
+        ExceptionState exceptions;
+        NvicModel nvic;
+        ScbModel scb;
+        SysTickModel sys_tick;
+        Cpu cpu;
+    };
+}
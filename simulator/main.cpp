@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "./machine.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+    void printUsage(const char* program)
+    {
+        std::fprintf(stderr,
+            "Usage: %s [options] <image>\n"
+            "\n"
+            "Runs an ARMv6-M image headless and reports cycle counts.\n"
+            "The image is an ELF32 executable, or a raw flash image with --binary.\n"
+            "Semihosting (BKPT 0xAB) SYS_WRITEC, SYS_WRITE0, SYS_WRITE, SYS_EXIT and SYS_EXIT_EXTENDED are supported.\n"
+            "\n"
+            "Options:\n"
+            "  --binary            Load <image> as a raw flash image at 0x00000000.\n"
+            "  --max-cycles <n>    Stop after n cycles (default: 100000000).\n"
+            "  --flash-size <n>    Flash size in bytes (default: 262144).\n"
+            "  --ram-size <n>      SRAM size in bytes (default: 65536).\n"
+            "  --trace             Print every executed instruction to stderr.\n"
+            "  --quiet             Do not print the cycle report.\n",
+            program
+        );
+    }
+
+    bool parseNumber(const char* text, uint64_t& value)
+    {
+        char* end = nullptr;
+        value = std::strtoull(text, &end, 0);
+        return (end != text) && (*end == '\0');
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace ArmCortex::Simulator;
+
+    bool binary = false;
+    bool trace = false;
+    bool quiet = false;
+    uint64_t max_cycles = 100'000'000;
+    uint64_t flash_size = 256 * 1024;
+    uint64_t ram_size = 64 * 1024;
+    const char* image = nullptr;
+
+    for (int index = 1; index < argc; ++index) {
+        const char* argument = argv[index];
+        const bool has_value = index + 1 < argc;
+
+        if (std::strcmp(argument, "--binary") == 0) {
+            binary = true;
+        } else if (std::strcmp(argument, "--trace") == 0) {
+            trace = true;
+        } else if (std::strcmp(argument, "--quiet") == 0) {
+            quiet = true;
+        } else if ((std::strcmp(argument, "--max-cycles") == 0) && has_value && parseNumber(argv[index + 1], max_cycles)) {
+            ++index;
+        } else if ((std::strcmp(argument, "--flash-size") == 0) && has_value && parseNumber(argv[index + 1], flash_size)) {
+            ++index;
+        } else if ((std::strcmp(argument, "--ram-size") == 0) && has_value && parseNumber(argv[index + 1], ram_size)) {
+            ++index;
+        } else if ((argument[0] != '-') && (image == nullptr)) {
+            image = argument;
+        } else {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((image == nullptr) || (flash_size > UINT32_MAX) || (ram_size > UINT32_MAX)) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Machine machine(static_cast<uint32_t>(flash_size), static_cast<uint32_t>(ram_size));
+    const std::string error = binary ? machine.loadBinary(image) : machine.loadElf(image);
+
+    if (!error.empty()) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    machine.cpu.trace = trace;
+    machine.reset();
+
+    const Halt halt = machine.run(max_cycles);
+    std::fflush(stdout);
+
+    if (!quiet) {
+        machine.printReport(stderr);
+    }
+
+    return (halt == Halt::EXIT) ? machine.cpu.exitCode() : EXIT_FAILURE;
+}
@@ -0,0 +1,455 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "./peripherals.hpp"
+
+#include <arm-cortex-m0-core/nvic.hpp>
+#include <arm-cortex-m0-core/scb.hpp>
+#include <arm-cortex-m0-core/systick.hpp>
+#include <cstddef>
+
+namespace ArmCortex::Simulator {
+    namespace {
+        constexpr uint8_t toNumber(ExceptionNumber exception)
+        {
+            return static_cast<uint8_t>(exception);
+        }
+
+        constexpr uint8_t FIRST_IRQ = toNumber(ExceptionNumber::FIRST_IRQ);
+
+        //! Merge the written byte lanes into the previous register value.
+        constexpr uint32_t merge(uint32_t old_value, uint32_t value, uint32_t mask)
+        {
+            return (old_value & ~mask) | (value & mask);
+        }
+    }
+
+    // =========================================================================
+    // Exception State
+    // =========================================================================
+
+    ExceptionState::ExceptionState(const uint64_t& cycles) : cycles(cycles)
+    {
+    }
+
+    void ExceptionState::reset()
+    {
+        pending.fill(false);
+        active.fill(false);
+        priority_bytes.fill(0);
+        pending_since.fill(0);
+        irq_enabled = 0;
+        current = 0;
+        sev_on_pend = false;
+        event = false;
+    }
+
+    void ExceptionState::setPending(uint8_t exception)
+    {
+        if (!pending[exception]) {
+            pending_since[exception] = cycles;
+
+            if (sev_on_pend) {
+                event = true;
+            }
+        }
+
+        pending[exception] = true;
+    }
+
+    void ExceptionState::clearPending(uint8_t exception)
+    {
+        pending[exception] = false;
+    }
+
+    bool ExceptionState::isEnabled(uint8_t exception) const
+    {
+        if (!isIrqNumber(exception)) {
+            return true;
+        }
+
+        return ArmCortex::isBitSet(irq_enabled, exception - FIRST_IRQ);
+    }
+
+    int ExceptionState::priority(uint8_t exception) const
+    {
+        switch (static_cast<ExceptionNumber>(exception)) {
+        case ExceptionNumber::RESET:
+            return -3;
+        case ExceptionNumber::NMI:
+            return -2;
+        case ExceptionNumber::HARD_FAULT:
+            return -1;
+        default:
+            return priority_bytes[exception];
+        }
+    }
+
+    int ExceptionState::executionPriority(bool primask) const
+    {
+        int result = BASE_PRIORITY;
+
+        for (uint8_t exception = 1; exception < NUM_OF_EXCEPTIONS; ++exception) {
+            if (active[exception] && (priority(exception) < result)) {
+                result = priority(exception);
+            }
+        }
+
+        if (primask && (result > 0)) {
+            result = 0;
+        }
+
+        return result;
+    }
+
+    std::optional<uint8_t> ExceptionState::highestPending() const
+    {
+        std::optional<uint8_t> result;
+
+        for (uint8_t exception = 1; exception < NUM_OF_EXCEPTIONS; ++exception) {
+            if (pending[exception] && isEnabled(exception) && (!result || (priority(exception) < priority(*result)))) {
+                result = exception;
+            }
+        }
+
+        return result;
+    }
+
+    bool ExceptionState::isAnyIrqPending() const
+    {
+        for (uint8_t exception = FIRST_IRQ; exception < NUM_OF_EXCEPTIONS; ++exception) {
+            if (pending[exception]) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // =========================================================================
+    // NVIC
+    // =========================================================================
+
+    uint32_t NvicModel::read(uint32_t offset)
+    {
+        if ((offset == offsetof(Nvic::Registers, ISER)) || (offset == offsetof(Nvic::Registers, ICER))) {
+            return exceptions.irq_enabled;
+        }
+
+        if ((offset == offsetof(Nvic::Registers, ISPR)) || (offset == offsetof(Nvic::Registers, ICPR))) {
+            uint32_t value = 0;
+
+            for (uint8_t irq = 0; irq < NUM_OF_IRQS; ++irq) {
+                if (exceptions.isPending(FIRST_IRQ + irq)) {
+                    ArmCortex::setBit(value, irq);
+                }
+            }
+
+            return value;
+        }
+
+        if ((offset >= offsetof(Nvic::Registers, IPR)) && (offset < sizeof(Nvic::Registers))) {
+            const uint8_t first_irq = static_cast<uint8_t>(offset - offsetof(Nvic::Registers, IPR));
+            uint32_t value = 0;
+
+            for (uint8_t byte = 0; byte < 4; ++byte) {
+                value |= uint32_t{exceptions.priorityByte(FIRST_IRQ + first_irq + byte)} << (byte * 8);
+            }
+
+            return value;
+        }
+
+        return 0;
+    }
+
+    void NvicModel::write(uint32_t offset, uint32_t value, uint32_t mask)
+    {
+        value &= mask;
+
+        if ((offset >= offsetof(Nvic::Registers, IPR)) && (offset < sizeof(Nvic::Registers))) {
+            const uint8_t first_irq = static_cast<uint8_t>(offset - offsetof(Nvic::Registers, IPR));
+
+            for (uint8_t byte = 0; byte < 4; ++byte) {
+                if (ArmCortex::isBitSet(mask, byte * 8)) {
+                    exceptions.setPriority(FIRST_IRQ + first_irq + byte, static_cast<uint8_t>(value >> (byte * 8)));
+                }
+            }
+
+            return;
+        }
+
+        for (uint8_t irq = 0; irq < NUM_OF_IRQS; ++irq) {
+            if (!ArmCortex::isBitSet(value, irq)) {
+                continue;
+            }
+
+            if (offset == offsetof(Nvic::Registers, ISER)) {
+                ArmCortex::setBit(exceptions.irq_enabled, irq);
+            } else if (offset == offsetof(Nvic::Registers, ICER)) {
+                ArmCortex::clearBit(exceptions.irq_enabled, irq);
+            } else if (offset == offsetof(Nvic::Registers, ISPR)) {
+                exceptions.setPending(FIRST_IRQ + irq);
+            } else if (offset == offsetof(Nvic::Registers, ICPR)) {
+                exceptions.clearPending(FIRST_IRQ + irq);
+            }
+        }
+    }
+
+    // =========================================================================
+    // SCB
+    // =========================================================================
+
+    void ScbModel::reset()
+    {
+        scr = 0;
+        reset_requested = false;
+    }
+
+    uint32_t ScbModel::read(uint32_t offset)
+    {
+        switch (offset) {
+        case offsetof(Scb::Registers, CPUID):
+            return CPUID_VALUE;
+
+        case offsetof(Scb::Registers, ICSR): {
+            Scb::ICSR icsr;
+            icsr.bits.VECTACTIVE = exceptions.current;
+            icsr.bits.VECTPENDING = exceptions.highestPending().value_or(0);
+            icsr.bits.ISRPENDING = exceptions.isAnyIrqPending();
+            icsr.bits.PENDSTSET = exceptions.isPending(toNumber(ExceptionNumber::SYS_TICK));
+            icsr.bits.PENDSVSET = exceptions.isPending(toNumber(ExceptionNumber::PEND_SV));
+            icsr.bits.NMIPENDSET = exceptions.isPending(toNumber(ExceptionNumber::NMI));
+            return icsr.value;
+        }
+
+        case offsetof(Scb::Registers, AIRCR): {
+            // VECTKEYSTAT reads as the inverted key.
+            Scb::AIRCR aircr;
+            aircr.bits.VECTKEY = static_cast<uint16_t>(~Scb::AIRCR::VECTKEY_VALUE);
+            return aircr.value;
+        }
+
+        case offsetof(Scb::Registers, SCR):
+            return scr;
+
+        case offsetof(Scb::Registers, CCR):
+            return CCR_VALUE;
+
+        case offsetof(Scb::Registers, SHPR2): {
+            Scb::SHPR2 shpr2;
+            shpr2.bits.PRI_11 = exceptions.priorityByte(toNumber(ExceptionNumber::SV_CALL));
+            return shpr2.value;
+        }
+
+        case offsetof(Scb::Registers, SHPR3): {
+            Scb::SHPR3 shpr3;
+            shpr3.bits.PRI_14 = exceptions.priorityByte(toNumber(ExceptionNumber::PEND_SV));
+            shpr3.bits.PRI_15 = exceptions.priorityByte(toNumber(ExceptionNumber::SYS_TICK));
+            return shpr3.value;
+        }
+
+        case offsetof(Scb::Registers, SHCSR): {
+            Scb::SHCSR shcsr;
+            shcsr.bits.SVCALLPENDED = exceptions.isPending(toNumber(ExceptionNumber::SV_CALL));
+            return shcsr.value;
+        }
+
+        default:
+            return 0;
+        }
+    }
+
+    void ScbModel::write(uint32_t offset, uint32_t value, uint32_t mask)
+    {
+        switch (offset) {
+        case offsetof(Scb::Registers, ICSR): {
+            const Scb::ICSR icsr { value & mask };
+
+            if (icsr.bits.NMIPENDSET) {
+                exceptions.setPending(toNumber(ExceptionNumber::NMI));
+            }
+
+            if (icsr.bits.PENDSVSET) {
+                exceptions.setPending(toNumber(ExceptionNumber::PEND_SV));
+            } else if (icsr.bits.PENDSVCLR) {
+                exceptions.clearPending(toNumber(ExceptionNumber::PEND_SV));
+            }
+
+            if (icsr.bits.PENDSTSET) {
+                exceptions.setPending(toNumber(ExceptionNumber::SYS_TICK));
+            } else if (icsr.bits.PENDSTCLR) {
+                exceptions.clearPending(toNumber(ExceptionNumber::SYS_TICK));
+            }
+
+            break;
+        }
+
+        case offsetof(Scb::Registers, AIRCR): {
+            const Scb::AIRCR aircr { value };
+
+            if ((mask == 0xFFFFFFFFu) && (aircr.bits.VECTKEY == Scb::AIRCR::VECTKEY_VALUE) && aircr.bits.SYSRESETREQ) {
+                reset_requested = true;
+            }
+
+            break;
+        }
+
+        case offsetof(Scb::Registers, SCR): {
+            Scb::SCR writable;
+            writable.bits.SLEEPONEXIT = 1;
+            writable.bits.SLEEPDEEP = 1;
+            writable.bits.SEVONPEND = 1;
+
+            scr = merge(scr, value, mask) & writable.value;
+            exceptions.sev_on_pend = Scb::SCR { scr }.bits.SEVONPEND;
+            break;
+        }
+
+        case offsetof(Scb::Registers, SHPR2): {
+            const Scb::SHPR2 shpr2 { merge(read(offset), value, mask) };
+            exceptions.setPriority(toNumber(ExceptionNumber::SV_CALL), shpr2.bits.PRI_11);
+            break;
+        }
+
+        case offsetof(Scb::Registers, SHPR3): {
+            const Scb::SHPR3 shpr3 { merge(read(offset), value, mask) };
+            exceptions.setPriority(toNumber(ExceptionNumber::PEND_SV), shpr3.bits.PRI_14);
+            exceptions.setPriority(toNumber(ExceptionNumber::SYS_TICK), shpr3.bits.PRI_15);
+            break;
+        }
+
+        case offsetof(Scb::Registers, SHCSR): {
+            const Scb::SHCSR shcsr { merge(read(offset), value, mask) };
+
+            if (shcsr.bits.SVCALLPENDED) {
+                exceptions.setPending(toNumber(ExceptionNumber::SV_CALL));
+            } else {
+                exceptions.clearPending(toNumber(ExceptionNumber::SV_CALL));
+            }
+
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    bool ScbModel::sleepOnExit() const
+    {
+        return Scb::SCR { scr }.bits.SLEEPONEXIT;
+    }
+
+    // =========================================================================
+    // SysTick
+    // =========================================================================
+
+    void SysTickModel::reset()
+    {
+        ctrl = 0;
+        load = 0;
+        val = 0;
+    }
+
+    uint32_t SysTickModel::read(uint32_t offset)
+    {
+        switch (offset) {
+        case offsetof(SysTick::Registers, CTRL): {
+            // COUNTFLAG clears on read.
+            const uint32_t value = ctrl;
+            SysTick::CTRL cleared { ctrl };
+            cleared.bits.COUNTFLAG = 0;
+            ctrl = cleared.value;
+            return value;
+        }
+
+        case offsetof(SysTick::Registers, LOAD):
+            return load;
+
+        case offsetof(SysTick::Registers, VAL):
+            return val;
+
+        case offsetof(SysTick::Registers, CALIB):
+            return CALIB_VALUE;
+
+        default:
+            return 0;
+        }
+    }
+
+    void SysTickModel::write(uint32_t offset, uint32_t value, uint32_t mask)
+    {
+        switch (offset) {
+        case offsetof(SysTick::Registers, CTRL): {
+            SysTick::CTRL written { merge(ctrl, value, mask) };
+            SysTick::CTRL updated { ctrl };
+            updated.bits.ENABLE = written.bits.ENABLE;
+            updated.bits.TICKINT = written.bits.TICKINT;
+            updated.bits.CLKSOURCE = written.bits.CLKSOURCE;
+            ctrl = updated.value;
+            break;
+        }
+
+        case offsetof(SysTick::Registers, LOAD):
+            load = merge(load, value, mask) & 0x00FFFFFFu;
+            break;
+
+        case offsetof(SysTick::Registers, VAL): {
+            // Any write clears the counter and COUNTFLAG.
+            SysTick::CTRL updated { ctrl };
+            updated.bits.COUNTFLAG = 0;
+            ctrl = updated.value;
+            val = 0;
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    void SysTickModel::tick(uint64_t cycles)
+    {
+        SysTick::CTRL control { ctrl };
+
+        if (!control.bits.ENABLE) {
+            return;
+        }
+
+        for (; cycles > 0; --cycles) {
+            if (val == 0) {
+                val = load;
+                continue;
+            }
+
+            if (--val == 0) {
+                control.bits.COUNTFLAG = 1;
+
+                if (control.bits.TICKINT) {
+                    exceptions.setPending(toNumber(ExceptionNumber::SYS_TICK));
+                }
+            }
+        }
+
+        ctrl = control.value;
+    }
+
+    bool SysTickModel::canInterrupt() const
+    {
+        const SysTick::CTRL control { ctrl };
+        return control.bits.ENABLE && control.bits.TICKINT && (load != 0);
+    }
+}
@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include "./bus.hpp"
+#include <arm-cortex-m0-core/exceptions.hpp>
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace ArmCortex::Simulator {
+    inline constexpr uint8_t NUM_OF_EXCEPTIONS = static_cast<uint8_t>(ExceptionNumber::LAST_IRQ) + 1;
+
+    //! Pending, active, enable and priority state of every exception, shared by the core and the NVIC/SCB models.
+    class ExceptionState {
+    public:
+        //! Lowest priority: no exception active.
+        static constexpr int BASE_PRIORITY = 256;
+
+        explicit ExceptionState(const uint64_t& cycles);
+
+        void reset();
+
+        void setPending(uint8_t exception);
+        void clearPending(uint8_t exception);
+        bool isPending(uint8_t exception) const { return pending[exception]; }
+
+        void setActive(uint8_t exception, bool value) { active[exception] = value; }
+        bool isActive(uint8_t exception) const { return active[exception]; }
+
+        //! Cycle at which the exception last became pending.
+        uint64_t pendingSince(uint8_t exception) const { return pending_since[exception]; }
+
+        //! Enable state of an IRQ (system exceptions are always enabled).
+        bool isEnabled(uint8_t exception) const;
+
+        //! Priority byte as written by software (only the top two bits are implemented).
+        void setPriority(uint8_t exception, uint8_t value) { priority_bytes[exception] = value & 0xC0u; }
+        uint8_t priorityByte(uint8_t exception) const { return priority_bytes[exception]; }
+
+        //! Effective priority: Reset -3, NMI -2, HardFault -1, otherwise the priority byte.
+        int priority(uint8_t exception) const;
+
+        //! Priority of the running code, boosted to 0 by PRIMASK.
+        int executionPriority(bool primask) const;
+
+        //! Enabled pending exception with the highest priority (lowest number on a tie).
+        std::optional<uint8_t> highestPending() const;
+
+        //! Any IRQ pending, enabled or not.
+        bool isAnyIrqPending() const;
+
+        uint32_t irq_enabled = 0; //!< NVIC enable bits.
+        uint8_t current = 0; //!< IPSR exception number, kept up to date by the core.
+        bool sev_on_pend = false; //!< SCR.SEVONPEND.
+        bool event = false; //!< Core event register (set by SEV, exception entry and return, and SEVONPEND).
+
+    private:
+        const uint64_t& cycles;
+        std::array<bool, NUM_OF_EXCEPTIONS> pending {};
+        std::array<bool, NUM_OF_EXCEPTIONS> active {};
+        std::array<uint8_t, NUM_OF_EXCEPTIONS> priority_bytes {};
+        std::array<uint64_t, NUM_OF_EXCEPTIONS> pending_since {};
+    };
+
+    //! NVIC model laid out as Nvic::Registers.
+    class NvicModel : public Device {
+    public:
+        explicit NvicModel(ExceptionState& exceptions) : exceptions(exceptions) {}
+
+        uint32_t read(uint32_t offset) override;
+        void write(uint32_t offset, uint32_t value, uint32_t mask) override;
+
+    private:
+        ExceptionState& exceptions;
+    };
+
+    //! SCB model laid out as Scb::Registers.
+    class ScbModel : public Device {
+    public:
+        static constexpr uint32_t CPUID_VALUE = 0x410CC200u; //!< ARM Cortex-M0 r0p0.
+        static constexpr uint32_t CCR_VALUE = 0x00000208u; //!< STKALIGN and UNALIGN_TRP.
+
+        explicit ScbModel(ExceptionState& exceptions) : exceptions(exceptions) {}
+
+        void reset();
+
+        uint32_t read(uint32_t offset) override;
+        void write(uint32_t offset, uint32_t value, uint32_t mask) override;
+
+        bool sleepOnExit() const;
+        bool isResetRequested() const { return reset_requested; }
+
+    private:
+        ExceptionState& exceptions;
+        uint32_t scr = 0;
+        bool reset_requested = false;
+    };
+
+    //! SysTick model laid out as SysTick::Registers. Counts processor clock cycles.
+    class SysTickModel : public Device {
+    public:
+        static constexpr uint32_t CALIB_VALUE = 0xC0000000u; //!< NOREF and SKEW set, TENMS unknown.
+
+        explicit SysTickModel(ExceptionState& exceptions) : exceptions(exceptions) {}
+
+        void reset();
+
+        uint32_t read(uint32_t offset) override;
+        void write(uint32_t offset, uint32_t value, uint32_t mask) override;
+
+        //! Advance the counter by a number of processor clock cycles.
+        void tick(uint64_t cycles);
+
+        //! The timer is running with its exception enabled, so it can wake a sleeping core.
+        bool canInterrupt() const;
+
+    private:
+        ExceptionState& exceptions;
+        uint32_t ctrl = 0;
+        uint32_t load = 0;
+        uint32_t val = 0;
+    };
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+// Built twice: as a host program printing the expected instruction count of every case, and by
+// delay_test.cmake with DELAY_TEST_SEQUENCES to the assembly of one delay_<cycles> function per case.
+
+#include <arm-cortex-m0-core/delay.hpp>
+
+using namespace ArmCortex;
+
+// Every plan shape: NOPs only, each counter load, padding NOPs, and a delay split into several loops.
+// The cycle counts name the generated functions, so they are written without digit separators.
+#define DELAY_TEST_CASES(CASE) \
+    CASE(0)                    \
+    CASE(1)                    \
+    CASE(16)                   \
+    CASE(17)                   \
+    CASE(100)                  \
+    CASE(1022)                 \
+    CASE(1023)                 \
+    CASE(1026)                 \
+    CASE(262145)               \
+    CASE(67108863)             \
+    CASE(67108883)
+
+static_assert(Delay::plan(0).cycles() == 0);
+static_assert(Delay::plan(Delay::MAX_NOP_CYCLES).instructions() == Delay::MAX_NOP_CYCLES);
+static_assert(Delay::plan(Delay::MAX_NOP_CYCLES + 1).cycles() == Delay::MAX_NOP_CYCLES + 1);
+static_assert(Delay::plan(1'022).setup_cycles == 1);
+static_assert(Delay::plan(1'023).setup_cycles == 3);
+static_assert(Delay::plan(1'023).cycles() == 1'023);
+static_assert(Delay::plan(262'145).setup_cycles == 5);
+static_assert(Delay::plan(262'145).cycles() == 262'145);
+static_assert(Delay::plan(Delay::MAX_LOOP_CYCLES).cycles() == Delay::MAX_LOOP_CYCLES);
+static_assert(Delay::MAX_LOOP_CYCLES == 67'108'863);
+
+// Run-time delayUs(): the cycle count follows the exact clock, also for clocks that are not a whole number of MHz.
+static_assert(Delay::microsecondsToCycles<48'000'000>(1'000) == 48'000);
+static_assert(Delay::microsecondsToCycles<12'500'000>(1'000) == 12'500);
+static_assert(Delay::microsecondsToCycles<12'500'000>(1) == 13);
+static_assert(Delay::microsecondsToCycles<32'768>(1'000) == 33);
+static_assert(Delay::microsecondsToCycles<32'768>(1) == 1);
+static_assert(Delay::microsecondsToCycles<48'000'000>(UINT32_MAX) == 206'158'430'160);
+static_assert(Delay::loopIterations(Delay::microsecondsToCycles<32'768>(1'000)) == 8);
+static_assert(Delay::loopIterations(Delay::microsecondsToCycles<12'500'000>(1'000)) == 3'125);
+static_assert(Delay::loopIterations(1) == 0);
+
+#if defined(DELAY_TEST_SEQUENCES)
+
+#define DELAY_TEST_FUNCTION(CYCLES) \
+    extern "C" void delay_##CYCLES() { delayCycles<CYCLES>(); }
+
+DELAY_TEST_CASES(DELAY_TEST_FUNCTION)
+
+#else
+
+#include <cstdio>
+
+//! Instructions emitted by delayCycles<N>(), following its split into single loops.
+template<uint32_t N>
+constexpr uint32_t instructions()
+{
+    if constexpr (N > Delay::MAX_LOOP_CYCLES) {
+        return instructions<Delay::MAX_LOOP_CYCLES>() + instructions<N - Delay::MAX_LOOP_CYCLES>();
+    } else {
+        static_assert(Delay::plan(N).cycles() == N);
+        return Delay::plan(N).instructions();
+    }
+}
+
+#define DELAY_TEST_PRINT(CYCLES) \
+    std::printf("%lu %lu\n", static_cast<unsigned long>(CYCLES), static_cast<unsigned long>(instructions<CYCLES>()));
+
+int main()
+{
+    DELAY_TEST_CASES(DELAY_TEST_PRINT)
+    return 0;
+}
+
+#endif
@@ -0,0 +1,258 @@
+# Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Runs the instruction sequences emitted by delayCycles<N>() in the simulator. Checks that each takes exactly
+# N cycles and is as many instructions long as its plan predicts.
+#
+# With TARGET_CXX, SOURCE is compiled for thumbv6m and its delay_<cycles> functions are called from the test image.
+# Otherwise GCC on x86-64 is used as a fallback: it passes the Thumb inline assembly through as text, so the
+# sequences are extracted from its assembly output and the register it picked for the loop counter is renamed
+# to r3. This checks the sequences delay.hpp asks for, not the code a Thumb compiler generates around them.
+#
+# Parameters:
+#   TARGET_CXX       - C++ compiler for thumbv6m (arm-none-eabi-g++ or Clang), optional.
+#   TARGET_FLAGS     - '|'-separated flags selecting the target for TARGET_CXX.
+#   NM               - llvm-nm executable, needed with TARGET_CXX.
+#   FALLBACK_CXX     - Host GCC targeting x86-64, optional.
+#   SOURCE           - delay.cpp.
+#   INCLUDE_DIR      - Library include directory.
+#   PLAN             - Host build of SOURCE, prints "<cycles> <instructions>" per case.
+#                      Instructions are counted as emitted, not as executed.
+#   LLVM_MC, OBJCOPY - llvm-mc and llvm-objcopy executables.
+#   SIMULATOR        - Simulator executable.
+#   WORK_DIR         - Directory for the generated images.
+
+cmake_minimum_required(VERSION 3.13)
+
+if(NOT TARGET_CXX AND NOT FALLBACK_CXX)
+    message(FATAL_ERROR "Either TARGET_CXX or FALLBACK_CXX is required")
+endif()
+
+string(REPLACE "|" ";" TARGET_FLAGS "${TARGET_FLAGS}")
+
+# Assembles `source` into the object `object` and the raw image `binary`.
+function(assemble source object binary)
+    execute_process(
+        COMMAND "${LLVM_MC}" -triple=thumbv6m-none-eabi -mcpu=cortex-m0 -filetype=obj "${source}" -o "${object}"
+        RESULT_VARIABLE result
+    )
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${LLVM_MC} failed on ${source}")
+    endif()
+
+    execute_process(
+        COMMAND "${OBJCOPY}" -O binary "${object}" "${binary}"
+        RESULT_VARIABLE result
+    )
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${OBJCOPY} failed on ${object}")
+    endif()
+endfunction()
+
+# Builds an image that runs `code` once from reset, followed by `appendix`, and exits.
+# Reports the cycles and instructions executed.
+function(run_image name code appendix)
+    set(source "${WORK_DIR}/${name}.s")
+
+    file(WRITE "${source}"
+        ".syntax unified\n"
+        ".thumb\n"
+        ".text\n"
+        "vectors:\n"
+        ".word 0x20001000\n"
+        ".word (reset - vectors) + 1\n"
+        ".p2align 1\n"
+        "reset:\n"
+        "${code}"
+        "  movs r0, #0x18\n"
+        "  ldr r1, =0x20026\n"
+        "  bkpt #0xab\n"
+        ".ltorg\n"
+        "${appendix}"
+    )
+
+    assemble("${source}" "${WORK_DIR}/${name}.o" "${WORK_DIR}/${name}.bin")
+
+    execute_process(
+        COMMAND "${SIMULATOR}" --binary "${WORK_DIR}/${name}.bin"
+        ERROR_VARIABLE report
+        RESULT_VARIABLE result
+    )
+
+    if(NOT result EQUAL 0 OR NOT report MATCHES "cycles: ([0-9]+)\ninstructions: ([0-9]+)\n")
+        message(FATAL_ERROR "${name} did not exit cleanly:\n${report}")
+    endif()
+
+    set(cycles ${CMAKE_MATCH_1} PARENT_SCOPE)
+    set(executed ${CMAKE_MATCH_2} PARENT_SCOPE)
+endfunction()
+
+execute_process(
+    COMMAND "${PLAN}"
+    OUTPUT_VARIABLE plan_output
+    RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${PLAN} failed")
+endif()
+
+set(sequences "${WORK_DIR}/delay_sequences.s")
+
+if(TARGET_CXX)
+    set(mode "${TARGET_CXX}")
+    set(compile_command "${TARGET_CXX}" ${TARGET_FLAGS})
+else()
+    set(mode "x86-64 fallback")
+    set(compile_command "${FALLBACK_CXX}" -masm=intel)
+endif()
+
+execute_process(
+    COMMAND ${compile_command} -std=c++20 -O2 -S -DDELAY_TEST_SEQUENCES -I "${INCLUDE_DIR}" "${SOURCE}" -o "${sequences}"
+    RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${compile_command} failed on ${SOURCE}")
+endif()
+
+message(STATUS "Delay sequences compiled with ${mode}")
+file(STRINGS "${sequences}" assembly_lines)
+
+if(TARGET_CXX)
+    # Local symbols let llvm-mc resolve the calls itself, as there is no linker.
+    # GCC may switch to divided syntax around inline assembly, which llvm-mc does not support;
+    # the inline assembly in delay.hpp is written in unified syntax.
+    set(functions_source "${WORK_DIR}/delay_functions.s")
+    set(functions "")
+
+    foreach(line IN LISTS assembly_lines)
+        if(NOT line MATCHES "^[ \t]*\\.(globa?l[ \t]|syntax[ \t]+divided)")
+            string(APPEND functions "${line}\n")
+        endif()
+    endforeach()
+
+    file(WRITE "${functions_source}" "${functions}")
+    assemble("${functions_source}" "${WORK_DIR}/delay_functions.o" "${WORK_DIR}/delay_functions.bin")
+
+    execute_process(
+        COMMAND "${NM}" --print-size "${WORK_DIR}/delay_functions.o"
+        OUTPUT_VARIABLE nm_output
+        RESULT_VARIABLE result
+    )
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${NM} failed on ${WORK_DIR}/delay_functions.o")
+    endif()
+
+    string(REPLACE "\n" ";" nm_lines "${nm_output}")
+
+    foreach(line IN LISTS nm_lines)
+        if(line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [Tt] delay_([0-9]+)$")
+            math(EXPR "size_${CMAKE_MATCH_2}" "0x${CMAKE_MATCH_1}")
+        endif()
+    endforeach()
+
+    if(NOT DEFINED size_0)
+        message(FATAL_ERROR "delay_0 not found in ${sequences}")
+    endif()
+
+    # delay_0 is the bare call and return every case pays for.
+    set(appendix ".include \"${functions_source}\"\n")
+    run_image(delay_0 "  bl delay_0\n" "${appendix}")
+else()
+    # Collect the inline assembly of every delay_<cycles> function, dropping the line markers.
+    set(function "")
+    set(inline FALSE)
+
+    foreach(line IN LISTS assembly_lines)
+        if(line MATCHES "^delay_([0-9]+):$")
+            set(function "${CMAKE_MATCH_1}")
+            set("body_${function}" "")
+        elseif(line STREQUAL "#APP")
+            set(inline TRUE)
+        elseif(line STREQUAL "#NO_APP")
+            set(inline FALSE)
+        elseif(inline AND function AND NOT line MATCHES "^#")
+            # The counter register GCC picked for the "l" constraint becomes r3.
+            string(REGEX REPLACE "([ \t,])(e[a-d]x|e[sd]i|ebp|r[0-9]+d)(,|$)" "\\1r3\\3" line "${line}")
+            string(APPEND "body_${function}" "${line}\n")
+        endif()
+    endforeach()
+
+    run_image(empty "" "")
+endif()
+
+set(overhead_cycles ${cycles})
+set(overhead_executed ${executed})
+
+string(REPLACE "\n" ";" plan_lines "${plan_output}")
+set(failures 0)
+set(cases 0)
+
+foreach(line IN LISTS plan_lines)
+    if(NOT line MATCHES "^([0-9]+) ([0-9]+)$")
+        continue()
+    endif()
+
+    set(expected_cycles ${CMAKE_MATCH_1})
+    set(expected_instructions ${CMAKE_MATCH_2})
+    set(name "delay_${expected_cycles}")
+
+    if(TARGET_CXX)
+        if(NOT DEFINED "size_${expected_cycles}")
+            message(FATAL_ERROR "${name} not found in ${sequences}")
+        endif()
+
+        # Every instruction is 16 bits wide.
+        math(EXPR length "(${size_${expected_cycles}} - ${size_0}) / 2")
+        run_image("${name}" "  bl ${name}\n" "${appendix}")
+    else()
+        if(NOT DEFINED "body_${expected_cycles}")
+            message(FATAL_ERROR "${name} not found in ${sequences}")
+        endif()
+
+        # Assemble the sequence on its own to count its instructions.
+        file(WRITE "${WORK_DIR}/${name}.body.s" ".syntax unified\n.thumb\n.text\n${body_${expected_cycles}}")
+        assemble("${WORK_DIR}/${name}.body.s" "${WORK_DIR}/${name}.body.o" "${WORK_DIR}/${name}.body.bin")
+        file(READ "${WORK_DIR}/${name}.body.bin" code HEX)
+        string(LENGTH "${code}" length)
+        math(EXPR length "${length} / 4")
+
+        run_image("${name}" "${body_${expected_cycles}}" "")
+    endif()
+
+    math(EXPR cycles "${cycles} - ${overhead_cycles}")
+    math(EXPR executed "${executed} - ${overhead_executed}")
+    math(EXPR cases "${cases} + 1")
+
+    set(result "delayCycles<${expected_cycles}>: ${cycles} cycles, ${length} instructions (${executed} executed)")
+
+    if((NOT cycles EQUAL expected_cycles) OR (NOT length EQUAL expected_instructions))
+        message(SEND_ERROR "${result}, expected ${expected_cycles} cycles, ${expected_instructions} instructions")
+        math(EXPR failures "${failures} + 1")
+    else()
+        message(STATUS "${result}")
+    endif()
+endforeach()
+
+if(cases EQUAL 0)
+    message(FATAL_ERROR "${PLAN} printed no cases")
+endif()
+
+if(failures GREATER 0)
+    message(FATAL_ERROR "${failures} of ${cases} delays took the wrong number of cycles or instructions")
+endif()
@@ -0,0 +1,55 @@
+@ Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+@ Licensed under the Apache License, Version 2.0 (the "License");
+@ you may not use this file except in compliance with the License.
+@ You may obtain a copy of the License at
+
+@     http://www.apache.org/licenses/LICENSE-2.0
+
+@ Unless required by applicable law or agreed to in writing, software
+@ distributed under the License is distributed on an "AS IS" BASIS,
+@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+@ See the License for the specific language governing permissions and
+@ limitations under the License.
+
+@ Exception entry sets the event register: a WFE at the start of a handler returns at once,
+@ even though the interrupted thread consumed the event register just before.
+
+.syntax unified
+.thumb
+.text
+vectors:
+.word 0x20001000
+.word (reset - vectors) + 1
+.rept 9
+.word 0
+.endr
+.word (svc - vectors) + 1
+
+.p2align 1
+reset:
+  @ leave the event register clear
+  sev
+  wfe
+  svc #0
+  ldr r3, =0x20000000
+  ldr r4, [r3]
+  cmp r4, #1
+  bne fail
+  movs r0, #0x18
+  ldr r1, =0x20026
+  bkpt #0xab
+fail:
+  movs r0, #0x18
+  movs r1, #1
+  bkpt #0xab
+
+svc:
+  @ sleeps with no wake-up source unless entry set the event register
+  wfe
+  movs r0, #1
+  ldr r3, =0x20000000
+  str r0, [r3]
+  bx lr
+
+.ltorg
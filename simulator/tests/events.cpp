@@ -0,0 +1,66 @@
+/*
+    Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+// Compile-only check that instantiates every events.hpp API.
+// With EVENTS_TEST_INVALID_SEMAPHORE it must fail to compile: the initial count exceeds the maximum.
+
+#include <arm-cortex-m0-core/events.hpp>
+
+using namespace ArmCortex;
+
+constinit EventFlag event_flag;
+constinit EventFlags event_flags;
+constinit Semaphore semaphore { 1, 4 };
+constinit Semaphore unbounded_semaphore;
+
+#if defined(EVENTS_TEST_INVALID_SEMAPHORE)
+Semaphore invalid_semaphore { 5, 3 };
+#endif
+
+extern "C" {
+    void events_waitForEvent() { waitForEvent(); }
+    void events_sendEvent() { sendEvent(); }
+
+    uint32_t events_criticalSection(volatile uint32_t* value)
+    {
+        CriticalSection lock;
+        CriticalSection nested;
+        return *value;
+    }
+
+    void events_eventFlag_set() { event_flag.set(); }
+    void events_eventFlag_clear() { event_flag.clear(); }
+    bool events_eventFlag_isSet() { return event_flag.isSet(); }
+    void events_eventFlag_wait() { event_flag.wait(); }
+
+    void events_eventFlags_set(uint32_t mask) { event_flags.set(mask); }
+    void events_eventFlags_clear(uint32_t mask) { event_flags.clear(mask); }
+    uint32_t events_eventFlags_get() { return event_flags.get(); }
+    uint32_t events_eventFlags_waitAny(uint32_t mask, bool clear) { return event_flags.waitAny(mask, clear); }
+    uint32_t events_eventFlags_waitAll(uint32_t mask, bool clear) { return event_flags.waitAll(mask, clear); }
+
+    bool events_semaphore_give() { return semaphore.give(); }
+    bool events_semaphore_tryTake() { return semaphore.tryTake(); }
+    void events_semaphore_take() { semaphore.take(); }
+    uint32_t events_semaphore_count() { return semaphore.count() + unbounded_semaphore.count(); }
+
+    uint32_t events_semaphore_local()
+    {
+        Semaphore local { 2, 2 };
+        local.tryTake();
+        return local.count();
+    }
+}
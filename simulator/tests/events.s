@@ -0,0 +1,150 @@
+@ Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+@ Licensed under the Apache License, Version 2.0 (the "License");
+@ you may not use this file except in compliance with the License.
+@ You may obtain a copy of the License at
+
+@     http://www.apache.org/licenses/LICENSE-2.0
+
+@ Unless required by applicable law or agreed to in writing, software
+@ distributed under the License is distributed on an "AS IS" BASIS,
+@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+@ See the License for the specific language governing permissions and
+@ limitations under the License.
+
+@ Semaphore and EventFlags handshake between thread mode and an ISR, using the instruction sequences events.hpp
+@ emits: thread mode sleeps in WFE inside take() and waitAll() while the SysTick handler gives and sets.
+@ Checks that every wait is woken, that give() saturates at the maximum, and the final count and flags.
+@
+@ SRAM layout: 0x20000000 Semaphore counter, 0x20000004 Semaphore max_count, 0x20000008 EventFlags flags,
+@ 0x2000000C SysTick count.
+
+.syntax unified
+.thumb
+.text
+vectors:
+.word 0x20001000
+.word (reset - vectors) + 1
+.rept 13
+.word 0
+.endr
+.word (systick - vectors) + 1
+
+.p2align 1
+reset:
+  @ Semaphore { 0, 2 }, no flags set
+  ldr r3, =0x20000000
+  movs r0, #0
+  str r0, [r3]
+  str r0, [r3, #8]
+  str r0, [r3, #12]
+  movs r0, #2
+  str r0, [r3, #4]
+  @ r6 counts WFE wake-ups
+  movs r6, #0
+  @ SysTick every 200 cycles
+  ldr r1, =0xE000E010
+  movs r0, #199
+  str r0, [r1, #4]
+  movs r0, #0
+  str r0, [r1, #8]
+  movs r0, #7
+  str r0, [r1]
+  @ Semaphore::take() three times, each one sleeps until the next give()
+  movs r5, #3
+take:
+  mrs r2, primask
+  cpsid i
+  ldr r0, [r3]
+  cmp r0, #0
+  beq take_empty
+  subs r0, #1
+  str r0, [r3]
+  msr primask, r2
+  subs r5, #1
+  bne take
+  b wait_all
+take_empty:
+  msr primask, r2
+  wfe
+  adds r6, #1
+  b take
+  @ EventFlags::waitAll(0x18), set by the fourth and fifth tick, cleared on exit
+wait_all:
+  movs r4, #0x18
+  mrs r2, primask
+  cpsid i
+  ldr r0, [r3, #8]
+  ands r0, r4
+  cmp r0, r4
+  beq wait_all_done
+  msr primask, r2
+  wfe
+  adds r6, #1
+  b wait_all
+wait_all_done:
+  ldr r0, [r3, #8]
+  bics r0, r4
+  str r0, [r3, #8]
+  msr primask, r2
+  @ one more tick while the semaphore is full
+1: wfi
+  ldr r0, [r3, #12]
+  cmp r0, #6
+  blo 1b
+  movs r0, #0
+  str r0, [r1]
+  @ gives at ticks 1-6 minus three takes, saturated at 2
+  ldr r0, [r3]
+  cmp r0, #2
+  bne fail
+  @ flags of ticks 1-6 except the two consumed by waitAll()
+  ldr r0, [r3, #8]
+  cmp r0, #0x27
+  bne fail
+  @ each of the four waits went through WFE at least once
+  cmp r6, #4
+  blo fail
+  movs r0, #0x18
+  ldr r1, =0x20026
+  bkpt #0xab
+fail:
+  movs r0, #0x18
+  movs r1, #1
+  bkpt #0xab
+
+@ Semaphore::give() and EventFlags::set(1 << tick) on every tick.
+systick:
+  ldr r3, =0x20000000
+  ldr r0, [r3, #12]
+  adds r0, #1
+  str r0, [r3, #12]
+  @ give()
+  mrs r2, primask
+  cpsid i
+  ldr r0, [r3]
+  ldr r1, [r3, #4]
+  cmp r0, r1
+  beq 1f
+  adds r0, #1
+  str r0, [r3]
+  msr primask, r2
+  sev
+  b 2f
+1: msr primask, r2
+2:
+  @ set(1 << (tick - 1))
+  ldr r0, [r3, #12]
+  subs r0, #1
+  movs r1, #1
+  lsls r1, r0
+  mrs r2, primask
+  cpsid i
+  ldr r0, [r3, #8]
+  orrs r0, r1
+  str r0, [r3, #8]
+  msr primask, r2
+  sev
+  bx lr
+
+.ltorg
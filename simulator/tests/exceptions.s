@@ -0,0 +1,143 @@
+@ Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+@ Licensed under the Apache License, Version 2.0 (the "License");
+@ you may not use this file except in compliance with the License.
+@ You may obtain a copy of the License at
+
+@     http://www.apache.org/licenses/LICENSE-2.0
+
+@ Unless required by applicable law or agreed to in writing, software
+@ distributed under the License is distributed on an "AS IS" BASIS,
+@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+@ See the License for the specific language governing permissions and
+@ limitations under the License.
+
+@ Takes every exception the core models: an external interrupt, SVCall with EXC_RETURN checked
+@ while running on the process stack, PendSV, SysTick waking WFI, and WFE with a pending event.
+@ Each handler stores a marker to SRAM, the thread checks them and exits through semihosting.
+
+.syntax unified
+.thumb
+.text
+vectors:
+.word 0x20001000
+.word (reset - vectors) + 1
+.word (nmi - vectors) + 1
+.word (hardfault - vectors) + 1
+.rept 7
+.word 0
+.endr
+.word (svc - vectors) + 1
+.word 0
+.word 0
+.word (pendsv - vectors) + 1
+.word (systick - vectors) + 1
+.word (irq0 - vectors) + 1
+.rept 31
+.word 0
+.endr
+
+.p2align 1
+reset:
+  @ switch thread mode to PSP
+  ldr r0, =0x20000800
+  msr psp, r0
+  movs r0, #2
+  msr control, r0
+  isb sy
+  @ enable IRQ0 and pend it
+  ldr r1, =0xE000E100
+  movs r0, #1
+  str r0, [r1]
+  ldr r2, =0xE000E200
+  str r0, [r2]
+  @ the IRQ0 handler runs before the next instruction and stores 1
+  ldr r3, =0x20000000
+  ldr r4, [r3]
+  cmp r4, #1
+  bne fail
+  @ SVC
+  svc #0
+  ldr r4, [r3, #4]
+  cmp r4, #2
+  bne fail
+  @ PendSV
+  ldr r1, =0xE000ED04
+  ldr r0, =0x10000000
+  str r0, [r1]
+  ldr r4, [r3, #8]
+  cmp r4, #3
+  bne fail
+  @ delay loop: 1 + 4 * 10 - 2 cycles
+  movs r5, #10
+1: subs r5, #1
+  bne 1b
+  @ SysTick: LOAD = 99, VAL = 0, CTRL = 7, WFI until three ticks have been counted
+  ldr r1, =0xE000E010
+  movs r0, #99
+  str r0, [r1, #4]
+  movs r0, #0
+  str r0, [r1, #8]
+  movs r0, #7
+  str r0, [r1]
+2: wfi
+  ldr r4, [r3, #12]
+  cmp r4, #3
+  blo 2b
+  movs r0, #0
+  str r0, [r1]
+  @ WFE with event set by SEV
+  sev
+  wfe
+  @ print and exit
+  movs r0, #4
+  adr r1, msg
+  bkpt #0xab
+  movs r0, #0x18
+  ldr r1, =0x20026
+  bkpt #0xab
+fail:
+  movs r0, #0x18
+  movs r1, #1
+  bkpt #0xab
+
+nmi:
+hardfault:
+  b fail
+
+svc:
+  mov r0, lr
+  ldr r1, =0xFFFFFFFD
+  cmp r0, r1
+  bne fail
+  movs r0, #2
+  ldr r3, =0x20000000
+  str r0, [r3, #4]
+  bx lr
+
+pendsv:
+  push {r4, lr}
+  movs r0, #3
+  ldr r3, =0x20000000
+  str r0, [r3, #8]
+  pop {r4, pc}
+
+systick:
+  ldr r3, =0x20000000
+  ldr r0, [r3, #12]
+  adds r0, #1
+  str r0, [r3, #12]
+  bx lr
+
+irq0:
+  mrs r0, ipsr
+  cmp r0, #16
+  bne fail
+  movs r0, #1
+  ldr r3, =0x20000000
+  str r0, [r3]
+  bx lr
+
+.ltorg
+.p2align 2
+msg: .asciz "hello from thumb\n"
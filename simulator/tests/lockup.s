@@ -0,0 +1,48 @@
+@ Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+@ Licensed under the Apache License, Version 2.0 (the "License");
+@ you may not use this file except in compliance with the License.
+@ You may obtain a copy of the License at
+
+@     http://www.apache.org/licenses/LICENSE-2.0
+
+@ Unless required by applicable law or agreed to in writing, software
+@ distributed under the License is distributed on an "AS IS" BASIS,
+@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+@ See the License for the specific language governing permissions and
+@ limitations under the License.
+
+@ Runs the two delay loop shapes emitted by delay.hpp, then faults inside HardFault.
+
+.syntax unified
+.thumb
+.text
+vectors:
+.word 0x20001000
+.word (reset - vectors) + 1
+.word 0
+.word (hardfault - vectors) + 1
+.p2align 1
+reset:
+  @ 1 + 4 * 25 - 2 + 1 = 100 cycles
+  movs r3, #25
+1: subs r3, #1
+  bne 1b
+  nop
+  @ 3 + 4 * 1023 - 2 + 2 = 4095 cycles
+  movs r3, #3
+  lsls r3, r3, #8
+  adds r3, #255
+2: subs r3, #1
+  bne 2b
+  nop
+  nop
+  @ unmapped address: bus fault escalates to HardFault
+  ldr r0, =0x40000000
+  ldr r0, [r0]
+  b .
+hardfault:
+  @ faulting again at HardFault priority locks the core up
+  ldr r0, =0x40000000
+  ldr r0, [r0]
+.ltorg
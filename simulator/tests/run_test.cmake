@@ -0,0 +1,63 @@
+# Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Assembles a test image, runs it in the simulator and compares the exit code, stdout and cycle report.
+#
+# Parameters:
+#   LLVM_MC, OBJCOPY - llvm-mc and llvm-objcopy executables.
+#   SIMULATOR        - Simulator executable.
+#   SOURCE           - Test image source, assembled for thumbv6m and loaded as a raw flash image.
+#   EXPECTED         - Expected output ("exit code: <n>", then the stdout and stderr sections).
+#   WORK_DIR         - Directory for the object and binary.
+#   ARGS             - '|'-separated extra simulator arguments.
+
+cmake_minimum_required(VERSION 3.13)
+
+string(REPLACE "|" ";" ARGS "${ARGS}")
+get_filename_component(name "${SOURCE}" NAME_WE)
+
+set(object "${WORK_DIR}/${name}.o")
+set(binary "${WORK_DIR}/${name}.bin")
+
+execute_process(
+    COMMAND "${LLVM_MC}" -triple=thumbv6m-none-eabi -mcpu=cortex-m0 -filetype=obj "${SOURCE}" -o "${object}"
+    RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${LLVM_MC} failed on ${SOURCE}")
+endif()
+
+execute_process(
+    COMMAND "${OBJCOPY}" -O binary "${object}" "${binary}"
+    RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${OBJCOPY} failed on ${object}")
+endif()
+
+execute_process(
+    COMMAND "${SIMULATOR}" --binary ${ARGS} "${binary}"
+    OUTPUT_VARIABLE simulator_stdout
+    ERROR_VARIABLE simulator_stderr
+    RESULT_VARIABLE exit_code
+)
+
+set(actual "exit code: ${exit_code}\n--- stdout\n${simulator_stdout}--- stderr\n${simulator_stderr}")
+file(READ "${EXPECTED}" expected)
+
+if(NOT actual STREQUAL expected)
+    message(FATAL_ERROR "Output of ${name} differs from ${EXPECTED}\n--- expected\n${expected}--- actual\n${actual}")
+endif()
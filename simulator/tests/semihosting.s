@@ -0,0 +1,54 @@
+@ Copyright (C) 2025 The Embedded Society <https://github.com/embedded-society/arm-cortex-m0-core>
+
+@ Licensed under the Apache License, Version 2.0 (the "License");
+@ you may not use this file except in compliance with the License.
+@ You may obtain a copy of the License at
+
+@     http://www.apache.org/licenses/LICENSE-2.0
+
+@ Unless required by applicable law or agreed to in writing, software
+@ distributed under the License is distributed on an "AS IS" BASIS,
+@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+@ See the License for the specific language governing permissions and
+@ limitations under the License.
+
+@ Writes through SYS_WRITEC and SYS_WRITE and exits with SYS_EXIT_EXTENDED and a non-zero exit code.
+
+.syntax unified
+.thumb
+.text
+vectors:
+.word 0x20001000
+.word (reset - vectors) + 1
+
+.p2align 1
+reset:
+  @ SYS_WRITEC
+  movs r0, #3
+  adr r1, character
+  bkpt #0xab
+  @ SYS_WRITE to stdout, r0 is the number of bytes not written
+  movs r0, #5
+  adr r1, write_block
+  bkpt #0xab
+  cmp r0, #0
+  bne fail
+  @ SYS_EXIT_EXTENDED
+  movs r0, #0x20
+  adr r1, exit_block
+  bkpt #0xab
+fail:
+  movs r0, #0x18
+  movs r1, #1
+  bkpt #0xab
+
+.p2align 2
+write_block:
+.word 1
+.word (text - vectors)
+.word 6
+exit_block:
+.word 0x20026
+.word 42
+character: .byte '>'
+text: .ascii " done\n"